@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 1000000
+
+//
+// Every iterate updates one of state.range(0) locations, so fewer locations
+// means more threads contend for the same cache line. Each location is
+// padded to its own 64 byte cache line, so locations do not share lines.
+//
+
+template <typename T>
+struct alignas(64) Slot {
+  T v;
+};
+
+template <typename AtomicPolicy>
+static void benchmark_atomic_add_double(benchmark::State& state)
+{
+  const int num_locations = state.range(0);
+  std::vector<Slot<double>> sums(num_locations, Slot<double>{0.0});
+  Slot<double>* s = sums.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](int i) {
+          RAJA::atomicAdd(AtomicPolicy{}, &s[i % num_locations].v, 1.0);
+        });
+  }
+}
+
+template <typename AtomicPolicy>
+static void benchmark_atomic_add_int(benchmark::State& state)
+{
+  const int num_locations = state.range(0);
+  std::vector<Slot<int>> sums(num_locations, Slot<int>{0});
+  Slot<int>* s = sums.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](int i) {
+          RAJA::atomicAdd(AtomicPolicy{}, &s[i % num_locations].v, 1);
+        });
+  }
+}
+
+template <typename AtomicPolicy>
+static void benchmark_atomic_max_double(benchmark::State& state)
+{
+  const int num_locations = state.range(0);
+  std::vector<Slot<double>> maxs(num_locations, Slot<double>{0.0});
+  Slot<double>* m = maxs.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](int i) {
+          RAJA::atomicMax(AtomicPolicy{},
+                          &m[i % num_locations].v,
+                          static_cast<double>(i));
+        });
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_atomic_add_double, RAJA::builtin_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_add_double, RAJA::omp_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_add_double, RAJA::std_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+
+BENCHMARK_TEMPLATE(benchmark_atomic_add_int, RAJA::builtin_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_add_int, RAJA::omp_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_add_int, RAJA::std_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+
+BENCHMARK_TEMPLATE(benchmark_atomic_max_double, RAJA::builtin_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_max_double, RAJA::omp_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(benchmark_atomic_max_double, RAJA::std_atomic)
+    ->Arg(1)->Arg(8)->Arg(64);
+
+BENCHMARK_MAIN();
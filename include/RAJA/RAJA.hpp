@@ -82,6 +82,8 @@
 #endif
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+#include "RAJA/index/SpaceFillingCurveSegment.hpp"
 
 //
 // Strongly typed index class
@@ -106,7 +108,10 @@
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/util/ViewCursor.hpp"
 
 
 //
@@ -180,4 +185,7 @@
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/histogram.hpp"
+#include "RAJA/pattern/segmented.hpp"
+
 #endif  // closing endif for header file include guard
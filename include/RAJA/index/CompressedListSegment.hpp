@@ -0,0 +1,483 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the compressed list segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CompressedListSegment_HPP
+#define RAJA_CompressedListSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Header of one block of a TypedCompressedListSegment.
+ *
+ * The j-th index of the block is base + j + packed[j], where packed[j] is
+ * stored in width bits starting at bit j * width of words[offset]. Runs of
+ * consecutive indices have packed[j] == 0 and take no bits at all.
+ */
+struct CompressedListBlock {
+  int64_t base;
+  uint64_t offset : 56;
+  uint64_t width : 8;
+};
+
+//! Number of bits needed to store value
+RAJA_INLINE uint32_t compressed_list_bits(uint64_t value)
+{
+  uint32_t bits = 0;
+  while (value != 0) {
+    ++bits;
+    value >>= 1;
+  }
+  return bits;
+}
+
+//! Read the j-th packed value of block, branch free
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t
+compressed_list_unpack(const CompressedListBlock& block,
+                       const uint64_t* words,
+                       Index_type j)
+{
+  const uint64_t pos = static_cast<uint64_t>(j) * block.width;
+  const uint64_t* w = words + block.offset + (pos >> 6);
+  const uint32_t shift = static_cast<uint32_t>(pos & 63);
+  // the next word is always readable, the word array has two words of padding
+  const uint64_t lo = w[0] >> shift;
+  const uint64_t hi = (w[1] << 1) << (63 - shift);
+  // low width bits set, all bits for a width of 64
+  const uint64_t width = block.width;
+  const uint64_t mask =
+      ((uint64_t(1) << (width & 63)) - 1) | (uint64_t(0) - (width >> 6));
+  return (lo | hi) & mask;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an arbitrary collection of indices stored in
+ *         compressed form.
+ *
+ *         The indices are split into blocks of block_size indices. In each
+ *         block, the indices are stored as bit-packed offsets from a base,
+ *         with the width in bits of the largest offset in the block.
+ *         Ascending runs of consecutive indices need no bits, and short
+ *         ascending runs separated by small gaps need only a few bits, so
+ *         typical sparse index lists take 4-8 times less memory than a
+ *         TypedListSegment and need that much less memory bandwidth to load.
+ *
+ *         The iterator decodes indices on the fly. Decoding does not branch
+ *         and all indices of a block use the same base and width, so loops
+ *         over the segment can vectorize with simd_exec.
+ *
+ *         Index data live in host memory, so the segment can be used with
+ *         CPU back-ends only. Traversal executes as:
+ *            for (i = 0; i < size(); ++i) {
+ *               expression using begin()[i] as array index.
+ *            }
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedCompressedListSegment
+{
+public:
+  //! value type for storage
+  using value_type = T;
+
+  //! expose underlying index type
+  using IndexType = RAJA::Index_type;
+
+  //! number of indices in a block, a power of two
+  static constexpr Index_type block_size = 128;
+
+  //! log2 of block_size
+  static constexpr Index_type block_shift = 7;
+
+  static_assert(Index_type(1) << block_shift == block_size,
+                "block_size must be 2^block_shift");
+
+  /*!
+   * Random access iterator that decodes the indices of a
+   * TypedCompressedListSegment.
+   */
+  class iterator
+  {
+  public:
+    using value_type = T;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr iterator() noexcept = default;
+
+    RAJA_HOST_DEVICE constexpr iterator(const detail::CompressedListBlock* blocks,
+                                        const uint64_t* words,
+                                        difference_type pos)
+        : m_blocks(blocks), m_words(words), m_pos(pos)
+    {
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE value_type operator[](difference_type rhs) const
+    {
+      const difference_type i = m_pos + rhs;
+      const detail::CompressedListBlock& block = m_blocks[i >> block_shift];
+      const difference_type j = i & (block_size - 1);
+      return static_cast<value_type>(
+          block.base + j +
+          static_cast<int64_t>(detail::compressed_list_unpack(block, m_words, j)));
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE value_type operator*() const
+    {
+      return (*this)[0];
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator+=(difference_type rhs)
+    {
+      m_pos += rhs;
+      return *this;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator& operator-=(difference_type rhs)
+    {
+      m_pos -= rhs;
+      return *this;
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator+(difference_type rhs) const
+    {
+      return iterator(m_blocks, m_words, m_pos + rhs);
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE iterator operator-(difference_type rhs) const
+    {
+      return iterator(m_blocks, m_words, m_pos - rhs);
+    }
+    RAJA_HOST_DEVICE friend RAJA_INLINE iterator operator+(difference_type lhs,
+                                                           const iterator& rhs)
+    {
+      return rhs + lhs;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE difference_type
+    operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator==(const iterator& rhs) const
+    {
+      return m_pos == rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator!=(const iterator& rhs) const
+    {
+      return m_pos != rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator<(const iterator& rhs) const
+    {
+      return m_pos < rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator>(const iterator& rhs) const
+    {
+      return m_pos > rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator<=(const iterator& rhs) const
+    {
+      return m_pos <= rhs.m_pos;
+    }
+    RAJA_HOST_DEVICE RAJA_INLINE bool operator>=(const iterator& rhs) const
+    {
+      return m_pos >= rhs.m_pos;
+    }
+
+  private:
+    const detail::CompressedListBlock* m_blocks = nullptr;
+    const uint64_t* m_words = nullptr;
+    difference_type m_pos = 0;
+  };
+
+  //! prevent compiler from providing a default constructor
+  TypedCompressedListSegment() = delete;
+
+  ///
+  /// Construct compressed list segment from given array with specified
+  /// length. The segment keeps no reference to the array.
+  ///
+  TypedCompressedListSegment(const value_type* values, Index_type length)
+  {
+    encode(values, length < 0 ? 0 : length);
+  }
+
+  ///
+  /// Construct compressed list segment from arbitrary object holding
+  /// indices.
+  ///
+  /// The object must provide methods: begin(), end(), size().
+  ///
+  template <typename Container>
+  explicit TypedCompressedListSegment(const Container& container)
+  {
+    std::vector<value_type> values(container.begin(), container.end());
+    encode(values.data(), static_cast<Index_type>(values.size()));
+  }
+
+  TypedCompressedListSegment(const TypedCompressedListSegment&) = default;
+  TypedCompressedListSegment(TypedCompressedListSegment&&) = default;
+  TypedCompressedListSegment& operator=(const TypedCompressedListSegment&) =
+      default;
+  TypedCompressedListSegment& operator=(TypedCompressedListSegment&&) =
+      default;
+
+  ///
+  /// Swap function for copy-and-swap idiom.
+  ///
+  void swap(TypedCompressedListSegment& other)
+  {
+    using std::swap;
+    swap(m_blocks, other.m_blocks);
+    swap(m_words, other.m_words);
+    swap(m_size, other.m_size);
+  }
+
+  //! accessor to get the begin iterator for a TypedCompressedListSegment
+  iterator begin() const
+  {
+    return iterator(m_blocks.data(), m_words.data(), 0);
+  }
+
+  //! accessor to get the end iterator for a TypedCompressedListSegment
+  iterator end() const
+  {
+    return iterator(m_blocks.data(), m_words.data(), m_size);
+  }
+
+  //! accessor to retrieve the total number of elements in a
+  //! TypedCompressedListSegment
+  Index_type size() const { return m_size; }
+
+  //! bytes of memory used to store the indices
+  size_t getStorageBytes() const
+  {
+    return m_blocks.size() * sizeof(detail::CompressedListBlock) +
+           m_words.size() * sizeof(uint64_t);
+  }
+
+  ///
+  /// Decode count indices starting at index first into out. The indices
+  /// are decoded one block at a time, with the base and width of the block
+  /// held fixed in the inner loop.
+  ///
+  void decode(Index_type first, Index_type count, value_type* out) const
+  {
+    Index_type i = 0;
+    while (i < count) {
+      const Index_type pos = first + i;
+      const detail::CompressedListBlock& block = m_blocks[pos >> block_shift];
+      const Index_type j0 = pos & (block_size - 1);
+      const Index_type n = (block_size - j0 < count - i) ? block_size - j0
+                                                         : count - i;
+      for (Index_type j = j0; j < j0 + n; ++j) {
+        out[i + j - j0] = static_cast<value_type>(
+            block.base + j +
+            static_cast<int64_t>(
+                detail::compressed_list_unpack(block, m_words.data(), j)));
+      }
+      i += n;
+    }
+  }
+
+  //! checks a pointer and size (Span) for equality to all elements in the
+  //! TypedCompressedListSegment
+  bool indicesEqual(const value_type* container, Index_type len) const
+  {
+    if (len != m_size) return false;
+    if (len > 0 && container == nullptr) return false;
+    const iterator it = begin();
+    for (Index_type i = 0; i < m_size; ++i) {
+      if (it[i] != container[i]) return false;
+    }
+    return true;
+  }
+
+  ///
+  /// Equality operator returns true if segments are equal; else false.
+  ///
+  /// The encoding of a list of indices is unique, so equal segments have
+  /// equal blocks and words.
+  ///
+  bool operator==(const TypedCompressedListSegment& other) const
+  {
+    if (m_size != other.m_size ||
+        m_blocks.size() != other.m_blocks.size() ||
+        m_words != other.m_words) {
+      return false;
+    }
+    for (size_t b = 0; b < m_blocks.size(); ++b) {
+      if (m_blocks[b].base != other.m_blocks[b].base ||
+          m_blocks[b].width != other.m_blocks[b].width) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedCompressedListSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+private:
+  //
+  // Split values into blocks and bit-pack the offsets of each block from
+  // the smallest value - position in the block.
+  //
+  void encode(const value_type* values, Index_type length)
+  {
+    m_size = length;
+
+    const Index_type num_blocks = (length + block_size - 1) >> block_shift;
+    m_blocks.resize(num_blocks);
+
+    size_t offset = 0;
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const Index_type first = b << block_shift;
+      const Index_type count =
+          (length - first < block_size) ? length - first : block_size;
+
+      int64_t base = static_cast<int64_t>(values[first]);
+      for (Index_type j = 1; j < count; ++j) {
+        const int64_t key = static_cast<int64_t>(values[first + j]) - j;
+        if (key < base) base = key;
+      }
+
+      uint64_t max_packed = 0;
+      for (Index_type j = 0; j < count; ++j) {
+        const uint64_t packed = static_cast<uint64_t>(
+            static_cast<int64_t>(values[first + j]) - j - base);
+        if (packed > max_packed) max_packed = packed;
+      }
+
+      detail::CompressedListBlock& block = m_blocks[b];
+      block.base = base;
+      block.width = detail::compressed_list_bits(max_packed);
+      block.offset = offset;
+
+      offset += (static_cast<size_t>(count) * block.width + 63) / 64;
+    }
+
+    // two words of padding so unpacking may always read the next word, even
+    // for a width 0 block whose offset is already past the packed words
+    m_words.assign(offset + 2, 0);
+
+    for (Index_type b = 0; b < num_blocks; ++b) {
+      const detail::CompressedListBlock& block = m_blocks[b];
+      if (block.width == 0) {
+        continue;
+      }
+      const Index_type first = b << block_shift;
+      const Index_type count =
+          (length - first < block_size) ? length - first : block_size;
+      for (Index_type j = 0; j < count; ++j) {
+        const uint64_t packed = static_cast<uint64_t>(
+            static_cast<int64_t>(values[first + j]) - j - block.base);
+        const uint64_t pos = static_cast<uint64_t>(j) * block.width;
+        uint64_t* w = &m_words[block.offset + (pos >> 6)];
+        const uint32_t shift = static_cast<uint32_t>(pos & 63);
+        w[0] |= packed << shift;
+        if (shift + block.width > 64) {
+          w[1] |= packed >> (64 - shift);
+        }
+      }
+    }
+  }
+
+  // block headers
+  std::vector<detail::CompressedListBlock> m_blocks;
+
+  // bit-packed offsets of all blocks
+  std::vector<uint64_t> m_words;
+
+  // size of list segment
+  Index_type m_size = 0;
+};
+
+template <typename T>
+constexpr Index_type TypedCompressedListSegment<T>::block_size;
+
+template <typename T>
+constexpr Index_type TypedCompressedListSegment<T>::block_shift;
+
+//! alias for A TypedCompressedListSegment with storage type @Index_type
+using CompressedListSegment = TypedCompressedListSegment<Index_type>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+/*!
+ *  Specialization of std::swap for TypedCompressedListSegment
+ */
+template <typename T>
+RAJA_INLINE void swap(RAJA::TypedCompressedListSegment<T>& a,
+                      RAJA::TypedCompressedListSegment<T>& b)
+{
+  a.swap(b);
+}
+}  // namespace std
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -329,6 +331,22 @@ public:
   }
 
 
+  ///
+  /// Returns the segment of type T0 stored at offset, for a segment whose
+  /// getSegmentTypeId() is T0_TypeId and getSegmentOffset() is offset.
+  ///
+  /// The type id is selected at compile time, so unlike getSegment and
+  /// segmentCall no comparisons over the segment types are made.
+  ///
+  RAJA_INLINE T0 const &getSegmentByTypeId(
+      std::integral_constant<int, T0_TypeId>,
+      Index_type offset) const
+  {
+    return *data[offset];
+  }
+
+  using PARENT::getSegmentByTypeId;
+
   ///
   /// Calls the operator "body" with the segment stored at segid.
   ///
@@ -732,6 +750,26 @@ public:
     return segment_icounts[segid];
   }
 
+  //! Returns the type id of the segment at segid, the segment types of
+  //! TypedIndexSet<T0, ..., TN> have type ids N, ..., 0
+  RAJA_INLINE Index_type getSegmentTypeId(size_t segid) const
+  {
+    return segment_types[segid];
+  }
+
+  //! Returns the offset of the segment at segid among the segments of
+  //! its type
+  RAJA_INLINE Index_type getSegmentOffset(size_t segid) const
+  {
+    return segment_offsets[segid];
+  }
+
+  //! Terminates the getSegmentByTypeId overloads of the segment types
+  RAJA_INLINE void getSegmentByTypeId(std::integral_constant<int, -1>,
+                                      Index_type) const
+  {
+  }
+
   //! Get an iterator to the end.
   iterator end() const { return iterator(getNumSegments()); }
 
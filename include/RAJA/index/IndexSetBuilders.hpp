@@ -20,10 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/pattern/forall.hpp"
+
 #include "RAJA/util/types.hpp"
 
 #include "camp/resource.hpp"
@@ -62,6 +67,217 @@ void buildIndexSetAligned(
     RAJA::Index_type range_align);
 
 
+namespace detail
+{
+
+// number of indices each task of a parallel index set build works on
+constexpr RAJA::Index_type get_build_chunk_length() { return 4096; }
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range segments and List segments from
+ *        the indices in [0, length) that satisfy a predicate.
+ *
+ *        Runs of at least range_min_length consecutive selected indices
+ *        become Range segments. The selected indices between them are
+ *        gathered into List segments.
+ *
+ *        The predicate is evaluated once per index, in parallel with the
+ *        given execution policy, and the runs are found by a parallel count
+ *        and scan over chunks of the indices. Only host execution policies
+ *        (sequential, OpenMP, TBB) are supported.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param length number of indices to test, indices are [0, length).
+ *  \param pred callable returning true for each index to include.
+ *  \param range_min_length min length of any range segment in index set.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Predicate>
+void buildIndexSetFromPredicate(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource& work_res,
+    RAJA::Index_type length,
+    Predicate pred,
+    RAJA::Index_type range_min_length)
+{
+  if (length <= 0) return;
+
+  const RAJA::Index_type chunk_len = detail::get_build_chunk_length();
+  const RAJA::Index_type num_chunks = (length + chunk_len - 1) / chunk_len;
+
+  std::vector<char> flags(length);
+  std::vector<RAJA::Index_type> chunk_starts(num_chunks);
+  std::vector<RAJA::Index_type> chunk_ends(num_chunks);
+
+  char* flag = flags.data();
+  RAJA::Index_type* starts = chunk_starts.data();
+  RAJA::Index_type* ends = chunk_ends.data();
+
+  //
+  // Flag selected indices and count the runs that start and end inside each
+  // chunk, after its first index. Each chunk only evaluates the predicate
+  // on its own indices.
+  //
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, num_chunks), [=](RAJA::Index_type c) {
+        const RAJA::Index_type lo = c * chunk_len;
+        const RAJA::Index_type hi = std::min(lo + chunk_len, length);
+        bool prev = pred(lo);
+        flag[lo] = prev;
+        RAJA::Index_type num_starts = 0;
+        RAJA::Index_type num_ends = 0;
+        for (RAJA::Index_type i = lo + 1; i < hi; ++i) {
+          const bool cur = pred(i);
+          flag[i] = cur;
+          num_starts += (cur && !prev) ? 1 : 0;
+          num_ends += (prev && !cur) ? 1 : 0;
+          prev = cur;
+        }
+        starts[c] = num_starts;
+        ends[c] = num_ends;
+      });
+
+  //
+  // Add the runs that start or end at the first index of each chunk, found
+  // from the flags on either side of it, and the run ending at length to
+  // the last chunk. Then scan the counts.
+  //
+  RAJA::Index_type num_runs = 0;
+  RAJA::Index_type num_run_ends = 0;
+  for (RAJA::Index_type c = 0; c < num_chunks; ++c) {
+    const RAJA::Index_type lo = c * chunk_len;
+    const bool prev = (lo > 0) && flag[lo - 1];
+    const bool cur = flag[lo];
+    const RAJA::Index_type s = starts[c] + ((cur && !prev) ? 1 : 0);
+    const bool last = (c == num_chunks - 1) && flag[length - 1];
+    const RAJA::Index_type e =
+        ends[c] + ((prev && !cur) ? 1 : 0) + (last ? 1 : 0);
+    starts[c] = num_runs;
+    ends[c] = num_run_ends;
+    num_runs += s;
+    num_run_ends += e;
+  }
+
+  if (num_runs == 0) return;
+
+  std::vector<RAJA::Index_type> run_begins(num_runs);
+  std::vector<RAJA::Index_type> run_ends(num_runs);
+
+  RAJA::Index_type* run_begin = run_begins.data();
+  RAJA::Index_type* run_end = run_ends.data();
+
+  //
+  // Each chunk writes its run starts and ends; the k-th start and the
+  // k-th end delimit the k-th run.
+  //
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, num_chunks), [=](RAJA::Index_type c) {
+        const RAJA::Index_type lo = c * chunk_len;
+        const RAJA::Index_type hi = std::min(lo + chunk_len, length);
+        bool prev = (lo > 0) && flag[lo - 1];
+        RAJA::Index_type s = starts[c];
+        RAJA::Index_type e = ends[c];
+        for (RAJA::Index_type i = lo; i < hi; ++i) {
+          const bool cur = flag[i];
+          if (cur && !prev) run_begin[s++] = i;
+          if (prev && !cur) run_end[e++] = i;
+          prev = cur;
+        }
+        if (hi == length && prev) run_end[e++] = length;
+      });
+
+  //
+  // Runs shorter than range_min_length are gathered into list index data,
+  // consecutive short runs share one list segment.
+  //
+  std::vector<RAJA::Index_type> list_offsets(num_runs + 1);
+  RAJA::Index_type list_length = 0;
+  for (RAJA::Index_type r = 0; r < num_runs; ++r) {
+    list_offsets[r] = list_length;
+    const RAJA::Index_type run_len = run_end[r] - run_begin[r];
+    if (run_len < range_min_length) list_length += run_len;
+  }
+  list_offsets[num_runs] = list_length;
+
+  std::vector<RAJA::Index_type> list_indices(list_length);
+  RAJA::Index_type* list_index = list_indices.data();
+  const RAJA::Index_type* list_offset = list_offsets.data();
+
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, num_runs), [=](RAJA::Index_type r) {
+        const RAJA::Index_type run_len = run_end[r] - run_begin[r];
+        if (run_len < range_min_length) {
+          for (RAJA::Index_type k = 0; k < run_len; ++k) {
+            list_index[list_offset[r] + k] = run_begin[r] + k;
+          }
+        }
+      });
+
+  RAJA::Index_type r = 0;
+  while (r < num_runs) {
+    if (run_end[r] - run_begin[r] >= range_min_length) {
+      iset.push_back(RangeSegment(run_begin[r], run_end[r]));
+      ++r;
+    } else {
+      const RAJA::Index_type r0 = r;
+      while (r < num_runs && run_end[r] - run_begin[r] < range_min_length) {
+        ++r;
+      }
+      iset.push_back(ListSegment(&list_index[list_offset[r0]],
+                                 list_offset[r] - list_offset[r0],
+                                 work_res));
+    }
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range segments and List segments from
+ *        the indices in [0, length) whose entry in a label array equals
+ *        the given label.
+ *
+ *        See buildIndexSetFromPredicate for how segments are formed.
+ *
+ *  \param iset reference to index set generated. Method assumes index set
+ *         is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param labels pointer to start of per-index label array.
+ *  \param length size of label array.
+ *  \param label label of the indices to include.
+ *  \param range_min_length min length of any range segment in index set.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename LabelT>
+void buildIndexSetFromLabels(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource& work_res,
+    const LabelT* const labels,
+    RAJA::Index_type length,
+    LabelT label,
+    RAJA::Index_type range_min_length)
+{
+  buildIndexSetFromPredicate<ExecPolicy>(
+      iset,
+      work_res,
+      length,
+      [=](RAJA::Index_type i) { return labels[i] == label; },
+      range_min_length);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 //
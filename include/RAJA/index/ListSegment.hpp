@@ -242,6 +242,34 @@ public:
     }
   }
 
+  ///
+  /// \brief Construct list segment from the indices in a span.
+  ///
+  /// If 'Unowned' is passed, the list segment holds a pointer to the span's
+  /// data and its length, so no memory is allocated and no indices are
+  /// copied. In this case, the indices must be accessible by the execution
+  /// policies the segment is used with, and must outlive the segment and
+  /// all copies of it. If 'Owned' is passed, the indices are copied into
+  /// host memory.
+  ///
+  /// For example, to iterate over indices of a mesh connectivity array
+  /// that is already in the right memory space:
+  ///
+  ///   RAJA::ListSegment seg(RAJA::make_span(conn, len), RAJA::Unowned);
+  ///
+  template <typename IterType,
+            typename SpanIndexType,
+            typename std::enable_if<
+                std::is_convertible<IterType, const value_type*>::value>::type* =
+                nullptr>
+  TypedListSegment(RAJA::Span<IterType, SpanIndexType> span,
+                   IndexOwnership owned)
+    : m_resource(getHostResource()), m_use_resource(true),
+      m_owned(Unowned), m_data(nullptr), m_size(0)
+  {
+    initIndexData(m_use_resource,
+                  span.data(), static_cast<Index_type>(span.size()), owned);
+  }
 
 /*
  * The following two ctors preserve the original list segment behavior for
@@ -387,6 +415,16 @@ public:
   }
 
 private:
+  //
+  // Host resource shared by list segments built from spans, so building
+  // an unowned segment does not allocate a resource.
+  //
+  static camp::resources::Resource& getHostResource()
+  {
+    static camp::resources::Resource host_res{camp::resources::Host()};
+    return host_res;
+  }
+
   //
   // Initialize segment data properly based on whether object
   // owns the index data.
@@ -0,0 +1,533 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining segments that visit the points of a
+ *          multi-dimensional box in Morton or Hilbert curve order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SpaceFillingCurveSegment_HPP
+#define RAJA_SpaceFillingCurveSegment_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/SpaceFillingCurve.hpp"
+#include "RAJA/util/camp_aliases.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename T, camp::idx_t>
+using sfc_repeat_t = T;
+
+template <typename T, typename Seq>
+struct sfc_index_tuple;
+
+template <typename T, camp::idx_t... Dims>
+struct sfc_index_tuple<T, camp::idx_seq<Dims...>> {
+  using type = RAJA::tuple<sfc_repeat_t<T, Dims>...>;
+};
+
+template <typename... Ts>
+struct sfc_all_integral : std::true_type {
+};
+
+template <typename T, typename... Ts>
+struct sfc_all_integral<T, Ts...>
+    : std::integral_constant<
+          bool,
+          std::is_integral<strip_index_type_t<T>>::value &&
+              sfc_all_integral<Ts...>::value> {
+};
+
+/*!
+ * Run of consecutive curve indices that are all inside the box, starting
+ * at the rank-th point of the segment.
+ */
+struct SfcBlock {
+  Index_type rank;
+  uint64_t code;
+};
+
+/*!
+ * The part of a space filling curve segment shared by all its copies:
+ * the curve, the box and the runs of the curve inside the box.
+ *
+ * The runs are the aligned sub-cubes of the curve that lie inside the box,
+ * merged where they are consecutive, so a box with power of two sizes that
+ * matches the curve is a single run. A table of the run at every
+ * 2^bucket_shift-th rank makes finding the run of a rank a lookup and a
+ * search over a few runs.
+ */
+template <typename Curve, typename StorageT>
+struct SfcSegmentData {
+  static constexpr size_t n_dims = Curve::num_dims;
+
+  Curve curve;
+  StorageT begin[n_dims];
+  StorageT end[n_dims];
+
+  //! runs in curve order, followed by a sentinel at the total size
+  std::vector<SfcBlock> blocks;
+  std::vector<size_t> buckets;
+  int bucket_shift = 0;
+
+  SfcSegmentData(std::array<StorageT, n_dims> const &b,
+                 std::array<StorageT, n_dims> const &e)
+  {
+    uint64_t extents[n_dims];
+    int max_bits = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      begin[d] = b[d];
+      end[d] = e[d] < b[d] ? b[d] : e[d];
+      extents[d] = static_cast<uint64_t>(end[d] - begin[d]);
+    }
+    curve = Curve(extents);
+    for (size_t d = 0; d < n_dims; ++d) {
+      max_bits = curve.bits(d) > max_bits ? curve.bits(d) : max_bits;
+    }
+
+    Index_type total = 0;
+    bool empty = false;
+    for (size_t d = 0; d < n_dims; ++d) {
+      empty = empty || extents[d] == 0;
+    }
+    if (!empty) {
+      add_blocks(extents, 0, max_bits, total);
+    }
+    blocks.push_back(SfcBlock{total, 0});
+
+    // about one bucket per run
+    const size_t num_blocks = blocks.size() - 1;
+    while ((total >> bucket_shift) > static_cast<Index_type>(num_blocks)) {
+      ++bucket_shift;
+    }
+    const size_t num_buckets =
+        static_cast<size_t>((total >> bucket_shift) + 1);
+    buckets.resize(num_buckets + 1);
+    size_t blk = 0;
+    for (size_t i = 0; i < num_buckets; ++i) {
+      const Index_type rank = static_cast<Index_type>(i) << bucket_shift;
+      while (blk < num_blocks && blocks[blk + 1].rank <= rank) {
+        ++blk;
+      }
+      buckets[i] = blk;
+    }
+    buckets[num_buckets] = num_blocks;
+  }
+
+  Index_type size() const { return blocks.back().rank; }
+
+  //! Index of the run containing rank, the sentinel for the total size
+  size_t locate(Index_type rank) const
+  {
+    const size_t num_blocks = blocks.size() - 1;
+    if (rank >= size()) {
+      return num_blocks;
+    }
+    const size_t bucket = static_cast<size_t>(rank >> bucket_shift);
+    size_t lo = buckets[bucket];
+    size_t hi = buckets[bucket + 1];
+    // last run in [lo, hi] that starts at or before rank
+    while (lo < hi) {
+      const size_t mid = lo + (hi - lo + 1) / 2;
+      if (blocks[mid].rank <= rank) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    return lo;
+  }
+
+private:
+  /*!
+   * Add the runs of the aligned sub-cube of the curve with the first curve
+   * index code, made of the low level bits of each dimension.
+   */
+  void add_blocks(const uint64_t (&extents)[n_dims],
+                  uint64_t code,
+                  int level,
+                  Index_type &total)
+  {
+    uint64_t corner[n_dims];
+    curve.decode(code, corner);
+
+    int node_bits = 0;
+    int child_dims = 0;
+    bool inside = true;
+    for (size_t d = 0; d < n_dims; ++d) {
+      const int bits = curve.bits(d) < level ? curve.bits(d) : level;
+      node_bits += bits;
+      child_dims += curve.bits(d) >= level ? 1 : 0;
+      corner[d] &= ~detail::sfc_low_mask(bits);
+      if (corner[d] >= extents[d]) {
+        return;
+      }
+      inside = inside && corner[d] + (uint64_t(1) << bits) <= extents[d];
+    }
+
+    if (inside) {
+      if (blocks.empty() ||
+          blocks.back().code +
+                  static_cast<uint64_t>(total - blocks.back().rank) !=
+              code) {
+        blocks.push_back(SfcBlock{total, code});
+      }
+      total += static_cast<Index_type>(uint64_t(1) << node_bits);
+      return;
+    }
+
+    const uint64_t child_size = uint64_t(1) << (node_bits - child_dims);
+    for (uint64_t child = 0; child < (uint64_t(1) << child_dims); ++child) {
+      add_blocks(extents, code + child * child_size, level - 1, total);
+    }
+  }
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Segment class visiting the points of an n-dimensional box in the
+ *         order of a space filling curve
+ *
+ * \tparam Curve the curve, a MortonCurve<n> or HilbertCurve<n>
+ * \tparam StorageT the underlying data type of each index
+ *
+ * Nests of RangeSegment loops walk a box in lexicographic order, so only
+ * the innermost dimension is visited with good locality. Visiting the
+ * points in curve order keeps points that are close in every dimension
+ * close in time, which helps stencils and transposes without a clear
+ * stride-one dimension.
+ *
+ * The value of each point is a RAJA::tuple of n indices, so loop bodies
+ * take the tuple:
+ *
+ *   RAJA::MortonSegment<3> seg(ni, nj, nk);
+ *   RAJA::forall<RAJA::loop_exec>(seg, [=](RAJA::MortonSegment<3>::value_type ijk) {
+ *     view(RAJA::get<0>(ijk), RAJA::get<1>(ijk), RAJA::get<2>(ijk)) = ...;
+ *   });
+ *
+ * The same works for one argument of RAJA::kernel. The iterator is a
+ * RandomAccessIterator, so parallel and tiling policies work as well.
+ *
+ * Boxes whose sizes are not powers of two are visited in the order of the
+ * curve over the padded box, skipping the points outside of the box. This
+ * costs a small host-side table per segment, which copies share, so the
+ * segment is host only.
+ *
+ ******************************************************************************
+ */
+template <typename Curve, typename StorageT>
+class TypedSpaceFillingCurveSegment
+{
+  using StripStorageT = strip_index_type_t<StorageT>;
+  using data_type = detail::SfcSegmentData<Curve, StripStorageT>;
+
+public:
+  static constexpr size_t n_dims = Curve::num_dims;
+
+  //! the curve type
+  using curve_type = Curve;
+
+  //! the value of each point, a tuple of n_dims indices
+  using value_type = typename detail::
+      sfc_index_tuple<StorageT, camp::make_idx_seq_t<n_dims>>::type;
+
+  using IndexType = Index_type;
+
+  //! RandomAccessIterator over the points, returning them by value
+  class iterator
+  {
+  public:
+    using value_type = TypedSpaceFillingCurveSegment::value_type;
+    using difference_type = Index_type;
+    using pointer = value_type *;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    iterator() = default;
+
+    iterator(data_type const *data, Index_type rank)
+        : m_data(data), m_rank(rank), m_block(data->locate(rank))
+    {
+    }
+
+    RAJA_INLINE value_type operator*() const
+    {
+      detail::SfcBlock const &blk = m_data->blocks[m_block];
+      uint64_t x[n_dims];
+      m_data->curve.decode(blk.code + static_cast<uint64_t>(m_rank - blk.rank),
+                           x);
+      return make_value(x, camp::make_idx_seq_t<n_dims>{});
+    }
+
+    RAJA_INLINE value_type operator[](difference_type n) const
+    {
+      return *(*this + n);
+    }
+
+    RAJA_INLINE iterator &operator++()
+    {
+      ++m_rank;
+      if (m_rank == m_data->blocks[m_block + 1].rank) {
+        ++m_block;
+      }
+      return *this;
+    }
+
+    RAJA_INLINE iterator &operator--()
+    {
+      if (m_rank == m_data->blocks[m_block].rank) {
+        --m_block;
+      }
+      --m_rank;
+      return *this;
+    }
+
+    RAJA_INLINE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    RAJA_INLINE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --(*this);
+      return tmp;
+    }
+
+    RAJA_INLINE iterator &operator+=(difference_type n)
+    {
+      m_rank += n;
+      const size_t num_blocks = m_data->blocks.size() - 1;
+      // stay in the current run if possible
+      if (m_block >= num_blocks || m_rank < m_data->blocks[m_block].rank ||
+          m_rank >= m_data->blocks[m_block + 1].rank) {
+        m_block = m_data->locate(m_rank);
+      }
+      return *this;
+    }
+
+    RAJA_INLINE iterator &operator-=(difference_type n)
+    {
+      return *this += -n;
+    }
+
+    RAJA_INLINE iterator operator+(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp += n;
+      return tmp;
+    }
+
+    friend RAJA_INLINE iterator operator+(difference_type n, iterator const &it)
+    {
+      return it + n;
+    }
+
+    RAJA_INLINE iterator operator-(difference_type n) const
+    {
+      iterator tmp(*this);
+      tmp -= n;
+      return tmp;
+    }
+
+    RAJA_INLINE difference_type operator-(iterator const &o) const
+    {
+      return m_rank - o.m_rank;
+    }
+
+    RAJA_INLINE bool operator==(iterator const &o) const
+    {
+      return m_rank == o.m_rank;
+    }
+    RAJA_INLINE bool operator!=(iterator const &o) const
+    {
+      return m_rank != o.m_rank;
+    }
+    RAJA_INLINE bool operator<(iterator const &o) const
+    {
+      return m_rank < o.m_rank;
+    }
+    RAJA_INLINE bool operator>(iterator const &o) const
+    {
+      return m_rank > o.m_rank;
+    }
+    RAJA_INLINE bool operator<=(iterator const &o) const
+    {
+      return m_rank <= o.m_rank;
+    }
+    RAJA_INLINE bool operator>=(iterator const &o) const
+    {
+      return m_rank >= o.m_rank;
+    }
+
+  private:
+    template <camp::idx_t... Dims>
+    RAJA_INLINE value_type make_value(const uint64_t (&x)[n_dims],
+                                      camp::idx_seq<Dims...>) const
+    {
+      return value_type(StorageT(static_cast<StripStorageT>(
+          m_data->begin[Dims] + static_cast<StripStorageT>(x[Dims])))...);
+    }
+
+    data_type const *m_data = nullptr;
+    Index_type m_rank = 0;
+    size_t m_block = 0;
+  };
+
+  //! construct a segment over the box [begin[d], end[d]) in each dimension
+  TypedSpaceFillingCurveSegment(std::array<StripStorageT, n_dims> const &begin,
+                                std::array<StripStorageT, n_dims> const &end)
+      : m_data(std::make_shared<data_type>(begin, end)),
+        m_begin(0),
+        m_end(m_data->size())
+  {
+  }
+
+  //! construct a segment over the box [0, extents[d]) in each dimension
+  template <typename... Extents,
+            typename std::enable_if<
+                sizeof...(Extents) == n_dims &&
+                detail::sfc_all_integral<Extents...>::value>::type * = nullptr>
+  explicit TypedSpaceFillingCurveSegment(Extents... extents)
+      : TypedSpaceFillingCurveSegment(
+            std::array<StripStorageT, n_dims>{},
+            std::array<StripStorageT, n_dims>{
+                {static_cast<StripStorageT>(stripIndexType(extents))...}})
+  {
+  }
+
+  //! disable compiler generated constructor
+  TypedSpaceFillingCurveSegment() = delete;
+
+  TypedSpaceFillingCurveSegment(TypedSpaceFillingCurveSegment &&) = default;
+  TypedSpaceFillingCurveSegment(TypedSpaceFillingCurveSegment const &) =
+      default;
+  TypedSpaceFillingCurveSegment &operator=(
+      TypedSpaceFillingCurveSegment const &) = default;
+  ~TypedSpaceFillingCurveSegment() = default;
+
+  //! swap one TypedSpaceFillingCurveSegment with another
+  RAJA_INLINE void swap(TypedSpaceFillingCurveSegment &other)
+  {
+    camp::safe_swap(m_data, other.m_data);
+    camp::safe_swap(m_begin, other.m_begin);
+    camp::safe_swap(m_end, other.m_end);
+  }
+
+  //! obtain an iterator to the first point of the segment
+  RAJA_INLINE iterator begin() const { return iterator(m_data.get(), m_begin); }
+
+  //! obtain an iterator past the last point of the segment
+  RAJA_INLINE iterator end() const { return iterator(m_data.get(), m_end); }
+
+  //! obtain the number of points in the segment
+  RAJA_INLINE Index_type size() const { return m_end - m_begin; }
+
+  //! Create a segment of the points begin to begin + length in curve order
+  RAJA_INLINE TypedSpaceFillingCurveSegment slice(Index_type begin,
+                                                  Index_type length) const
+  {
+    TypedSpaceFillingCurveSegment s(*this);
+    s.m_begin = m_begin + begin < m_end ? m_begin + begin : m_end;
+    s.m_end = s.m_begin + length < m_end ? s.m_begin + length : m_end;
+    return s;
+  }
+
+  //! the curve of this segment
+  RAJA_INLINE curve_type const &getCurve() const { return m_data->curve; }
+
+  //! equality comparison, true if both visit the same points in order
+  RAJA_INLINE bool operator==(TypedSpaceFillingCurveSegment const &o) const
+  {
+    if (m_begin != o.m_begin || m_end != o.m_end) {
+      return false;
+    }
+    for (size_t d = 0; d < n_dims; ++d) {
+      if (m_data->begin[d] != o.m_data->begin[d] ||
+          m_data->end[d] != o.m_data->end[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  RAJA_INLINE bool operator!=(TypedSpaceFillingCurveSegment const &o) const
+  {
+    return !(operator==(o));
+  }
+
+private:
+  std::shared_ptr<const data_type> m_data;
+  Index_type m_begin;
+  Index_type m_end;
+};
+
+template <typename Curve, typename StorageT>
+constexpr size_t TypedSpaceFillingCurveSegment<Curve, StorageT>::n_dims;
+
+//! Segment visiting a box in Morton (Z-order) curve order
+template <typename StorageT, size_t n_dims>
+using TypedMortonSegment =
+    TypedSpaceFillingCurveSegment<MortonCurve<n_dims>, StorageT>;
+
+template <size_t n_dims>
+using MortonSegment = TypedMortonSegment<Index_type, n_dims>;
+
+//! Segment visiting a box in Hilbert curve order
+template <typename StorageT, size_t n_dims>
+using TypedHilbertSegment =
+    TypedSpaceFillingCurveSegment<HilbertCurve<n_dims>, StorageT>;
+
+template <size_t n_dims>
+using HilbertSegment = TypedHilbertSegment<Index_type, n_dims>;
+
+}  // namespace RAJA
+
+namespace std
+{
+
+//! specialization of swap for TypedSpaceFillingCurveSegment
+template <typename Curve, typename StorageT>
+RAJA_INLINE void swap(RAJA::TypedSpaceFillingCurveSegment<Curve, StorageT> &a,
+                      RAJA::TypedSpaceFillingCurveSegment<Curve, StorageT> &b)
+{
+  a.swap(b);
+}
+
+}  // namespace std
+
+#endif  // closing endif for header file include guard
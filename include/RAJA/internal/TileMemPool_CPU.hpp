@@ -0,0 +1,165 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the per-thread buffer pool that backs CPU
+ *          tile memory for RAJA local arrays.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TileMemPool_CPU_HPP
+#define RAJA_TileMemPool_CPU_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Alignment of every array handed out from a tile buffer, one cache line
+constexpr size_t tile_mem_align = 64;
+
+//! Size and alignment of tile buffers that ask for huge page backing
+constexpr size_t tile_mem_huge_page_size = size_t(2) * 1024 * 1024;
+
+//! Round nbytes up to a whole number of tile_mem_align chunks
+RAJA_INLINE constexpr size_t tile_mem_round_up(size_t nbytes)
+{
+  return (nbytes + tile_mem_align - 1) / tile_mem_align * tile_mem_align;
+}
+
+/*!
+ * Stack of reusable tile buffers owned by one thread.
+ *
+ * Each nesting level of InitLocalMem uses the buffer at its depth, so
+ * nested statements never overlap. Buffers only grow, which means that
+ * after the first entry into a kernel no further allocations are made.
+ * The buffers are released when the thread exits.
+ */
+class TileMemStack
+{
+public:
+  TileMemStack() = default;
+
+  TileMemStack(TileMemStack const&) = delete;
+  TileMemStack& operator=(TileMemStack const&) = delete;
+
+  ~TileMemStack()
+  {
+    for (Buffer& buf : m_buffers) {
+      free_aligned(buf.ptr);
+    }
+  }
+
+  /*!
+   * Get a buffer of at least nbytes for the next nesting level.
+   * Every call must be matched by a call to pop.
+   */
+  void* push(size_t nbytes, bool huge_pages)
+  {
+    if (m_depth == m_buffers.size()) {
+      m_buffers.push_back(Buffer{});
+    }
+    Buffer& buf = m_buffers[m_depth];
+    if (buf.capacity < nbytes || buf.huge_pages != huge_pages) {
+      // reset before allocating so a failed allocation leaves no
+      // dangling pointer for the destructor to free again
+      free_aligned(buf.ptr);
+      buf = Buffer{};
+      buf = allocate(nbytes, huge_pages);
+    }
+    ++m_depth;
+    return buf.ptr;
+  }
+
+  void pop() { --m_depth; }
+
+private:
+  struct Buffer {
+    void* ptr = nullptr;
+    size_t capacity = 0;
+    bool huge_pages = false;
+  };
+
+  static Buffer allocate(size_t nbytes, bool huge_pages)
+  {
+    Buffer buf;
+    const size_t align = huge_pages ? tile_mem_huge_page_size : tile_mem_align;
+    buf.capacity = (nbytes + align - 1) / align * align;
+    buf.huge_pages = huge_pages;
+    buf.ptr = allocate_aligned(align, buf.capacity);
+    if (buf.ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("InitLocalMem tile buffer allocation failed");
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (huge_pages) {
+      // only a hint, fall back to normal pages if it is not honored
+      madvise(buf.ptr, buf.capacity, MADV_HUGEPAGE);
+    }
+#endif
+    return buf;
+  }
+
+  std::vector<Buffer> m_buffers;
+  size_t m_depth = 0;
+};
+
+//! Get the tile buffer stack of the calling thread
+RAJA_INLINE TileMemStack& get_tile_mem_stack()
+{
+  static thread_local TileMemStack stack;
+  return stack;
+}
+
+/*!
+ * Scoped buffer from the calling thread's tile buffer stack, returned to
+ * the stack when the scope exits, even by an exception.
+ */
+class TileMemScope
+{
+public:
+  TileMemScope(size_t nbytes, bool huge_pages)
+      : m_stack(get_tile_mem_stack()),
+        m_ptr(static_cast<char*>(m_stack.push(nbytes, huge_pages)))
+  {
+  }
+
+  TileMemScope(TileMemScope const&) = delete;
+  TileMemScope& operator=(TileMemScope const&) = delete;
+
+  ~TileMemScope() { m_stack.pop(); }
+
+  char* get() const { return m_ptr; }
+
+private:
+  TileMemStack& m_stack;
+  char* m_ptr;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -22,6 +22,7 @@
 
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_std.hpp"
 
 #include "RAJA/util/macros.hpp"
 
@@ -58,6 +59,10 @@ namespace RAJA
  *
  *   builtin_atomic    -- Use the (nonstandard) __sync_fetch_and_XXX functions
  *
+ *   std_atomic        -- Use std::atomic_ref (or __atomic builtins before
+ *                        C++20), hardware read-modify-write for integral
+ *                        types and CAS with backoff otherwise
+ *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
  *
@@ -75,6 +80,7 @@ namespace RAJA
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_std.hpp      -- for std_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -45,6 +45,10 @@ template <typename Container>
 using ContainerVal =
     camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
 
+template <typename UnaryFunc, typename Iter>
+using TransformVal =
+    camp::decay<decltype(camp::val<UnaryFunc>()(*camp::val<Iter>()))>;
+
 template <typename DiffType, typename CountType>
 RAJA_INLINE
 DiffType firstIndex(DiffType n, CountType num_threads, CountType thread_id)
@@ -52,6 +56,34 @@ DiffType firstIndex(DiffType n, CountType num_threads, CountType thread_id)
   return (static_cast<size_t>(n) * thread_id) / num_threads;
 }
 
+/*!
+    \brief value functional that reads values from an iterator
+*/
+template <typename ValIter>
+struct IterValues
+{
+  ValIter vals;
+
+  template <typename DiffType>
+  RAJA_INLINE auto operator()(DiffType i) const -> decltype(vals[i])
+  {
+    return vals[i];
+  }
+};
+
+/*!
+    \brief value functional that always returns one
+*/
+template <typename T>
+struct OneValues
+{
+  template <typename DiffType>
+  RAJA_INLINE T operator()(DiffType) const
+  {
+    return T(1);
+  }
+};
+
 }  // end namespace detail
 
 
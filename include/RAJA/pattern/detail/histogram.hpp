@@ -0,0 +1,201 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with helpers shared by the scatter_add and histogram
+ *          implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_histogram_HPP
+#define RAJA_pattern_detail_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Strategies used by scatter_add and histogram to combine updates
+ *        that target the same bin.
+ *
+ *  automatic   - chosen from the number of updates, bins and threads
+ *  privatized  - per-thread copies of the bins merged at the end
+ *  atomic      - atomic updates directly into the output bins
+ *  sort_reduce - sort (bin, value) pairs, then reduce runs of equal bins
+ */
+enum class ScatterStrategy { automatic, privatized, atomic, sort_reduce };
+
+namespace detail
+{
+namespace histogram
+{
+
+// privatized bins per thread must fit in this many bytes (roughly L2 sized)
+constexpr size_t get_max_private_bytes() { return size_t(1) << 20; }
+
+// number of updates sampled when looking for heavily contended bins
+constexpr size_t get_num_samples() { return 256; }
+
+// this number is arbitrary
+constexpr size_t get_min_iterates_per_thread() { return 1024; }
+
+/*!
+    \brief returns the fraction of sampled updates that hit the most
+           frequently sampled bin
+*/
+template <typename IdxIter, typename DiffType>
+inline double sampled_max_bin_fraction(IdxIter idx, DiffType n)
+{
+  using key_type = camp::decay<decltype(idx[0])>;
+
+  const DiffType num_samples =
+      std::min(n, static_cast<DiffType>(get_num_samples()));
+  if (num_samples == 0) {
+    return 0.0;
+  }
+
+  key_type samples[get_num_samples()];
+  for (DiffType s = 0; s < num_samples; ++s) {
+    samples[s] = idx[firstIndex(n, num_samples, s)];
+  }
+  std::sort(samples, samples + num_samples);
+
+  DiffType max_run = 1;
+  DiffType run = 1;
+  for (DiffType s = 1; s < num_samples; ++s) {
+    run = (samples[s] == samples[s - 1]) ? run + 1 : 1;
+    max_run = std::max(max_run, run);
+  }
+
+  return static_cast<double>(max_run) / static_cast<double>(num_samples);
+}
+
+/*!
+    \brief choose a strategy for scattering n updates into num_bins bins
+           with num_threads threads
+
+    Privatization is used when every thread can keep a copy of the bins
+    in cache and the merge costs less than the updates themselves.
+    Otherwise atomics are used, unless sampling shows a few bins take a
+    large fraction of the updates; then the atomics would serialize on
+    those bins and sorting the updates is cheaper.
+*/
+template <typename T, typename IdxIter, typename DiffType>
+inline ScatterStrategy select_strategy(ScatterStrategy requested,
+                                       IdxIter idx,
+                                       DiffType n,
+                                       DiffType num_bins,
+                                       DiffType num_threads)
+{
+  if (requested != ScatterStrategy::automatic) {
+    return requested;
+  }
+
+  const size_t private_bytes = static_cast<size_t>(num_bins) * sizeof(T);
+  if (private_bytes <= get_max_private_bytes() &&
+      static_cast<size_t>(num_bins) * num_threads <= static_cast<size_t>(n)) {
+    return ScatterStrategy::privatized;
+  }
+
+  if (sampled_max_bin_fraction(idx, n) * num_threads > 1.0) {
+    return ScatterStrategy::sort_reduce;
+  }
+
+  return ScatterStrategy::atomic;
+}
+
+/*!
+    \brief add values with indices in [i_begin, i_end) into bins
+*/
+template <typename IdxIter, typename ValFn, typename OutIter, typename DiffType>
+RAJA_INLINE void scatter_range(IdxIter idx,
+                               ValFn val,
+                               OutIter out,
+                               DiffType i_begin,
+                               DiffType i_end)
+{
+  for (DiffType i = i_begin; i < i_end; ++i) {
+    out[idx[i]] += val(i);
+  }
+}
+
+/*!
+    \brief find the range of sorted keys in [0, n) whose runs start in
+           [first_index(chunk), first_index(chunk+1)), so that each run is
+           owned by exactly one of num_chunks chunks
+*/
+template <typename KeyIter, typename DiffType>
+RAJA_INLINE void owned_runs(KeyIter keys,
+                            DiffType n,
+                            DiffType num_chunks,
+                            DiffType chunk,
+                            DiffType& i_begin,
+                            DiffType& i_end)
+{
+  i_begin = firstIndex(n, num_chunks, chunk);
+  i_end = firstIndex(n, num_chunks, chunk + 1);
+
+  // skip the tail of a run started by an earlier chunk
+  const DiffType i_chunk_end = i_end;
+  while (i_begin < i_chunk_end && i_begin > 0 &&
+         keys[i_begin] == keys[i_begin - 1]) {
+    ++i_begin;
+  }
+  if (i_begin == i_chunk_end) {
+    i_end = i_begin;
+    return;
+  }
+
+  // finish the last run this chunk started
+  while (i_end < n && keys[i_end] == keys[i_end - 1]) {
+    ++i_end;
+  }
+}
+
+/*!
+    \brief reduce runs of equal sorted keys in [i_begin, i_end) and add
+           each run's total into its bin
+*/
+template <typename KeyIter, typename ValIter, typename OutIter, typename DiffType>
+RAJA_INLINE void reduce_runs(KeyIter keys,
+                             ValIter vals,
+                             OutIter out,
+                             DiffType i_begin,
+                             DiffType i_end)
+{
+  DiffType i = i_begin;
+  while (i < i_end) {
+    auto key = keys[i];
+    auto sum = vals[i];
+    for (++i; i < i_end && keys[i] == key; ++i) {
+      sum += vals[i];
+    }
+    out[key] += sum;
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,368 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with helpers shared by the segmented reduce and scan
+ *          implementations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_detail_segmented_HPP
+#define RAJA_pattern_detail_segmented_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace detail
+{
+namespace segmented
+{
+
+// this number is arbitrary
+constexpr size_t get_min_iterates_per_thread() { return 1024; }
+
+/*!
+    \brief head functional that starts a segment wherever the key differs
+           from the previous key, so runs of equal keys form the segments
+*/
+template <typename KeyIter>
+struct KeyHeads
+{
+  KeyIter keys;
+
+  template <typename DiffType>
+  RAJA_INLINE bool operator()(DiffType i) const
+  {
+    return i == 0 || !(keys[i] == keys[i - 1]);
+  }
+};
+
+/*!
+    \brief find the elements [lo, hi) and the segments [s_begin, s_end)
+           owned by chunk of num_chunks
+
+    Elements, not segments, are divided evenly so a few very long segments
+    do not leave the other chunks idle. A chunk owns the segments that
+    start in its elements, the last chunk also owns empty trailing segments.
+*/
+template <typename OffIter, typename DiffType>
+RAJA_INLINE void chunk_segments(OffIter offsets,
+                                DiffType num_segments,
+                                DiffType num_chunks,
+                                DiffType chunk,
+                                DiffType& lo,
+                                DiffType& hi,
+                                DiffType& s_begin,
+                                DiffType& s_end)
+{
+  const DiffType base = offsets[0];
+  const DiffType n = offsets[num_segments] - base;
+
+  lo = base + firstIndex(n, num_chunks, chunk);
+  hi = base + firstIndex(n, num_chunks, chunk + 1);
+
+  s_begin = (chunk == 0)
+                ? DiffType(0)
+                : static_cast<DiffType>(
+                      std::lower_bound(offsets, offsets + num_segments, lo) -
+                      offsets);
+  s_end = (chunk + 1 == num_chunks)
+              ? num_segments
+              : static_cast<DiffType>(
+                    std::lower_bound(offsets, offsets + num_segments, hi) -
+                    offsets);
+}
+
+/*!
+    \brief reduce the segments owned by a chunk into out, and the part of
+           the segment continuing into the chunk from before into carry
+
+    carry_seg is set to the continuing segment, or -1 if there is none.
+    Owned segments that continue past hi only hold a partial result.
+*/
+template <typename Iter,
+          typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void reduce_chunk(Iter vals,
+                              OffIter offsets,
+                              DiffType lo,
+                              DiffType hi,
+                              DiffType s_begin,
+                              DiffType s_end,
+                              OutIter out,
+                              BinFn f,
+                              T identity,
+                              DiffType& carry_seg,
+                              T& carry)
+{
+  carry_seg = -1;
+  if (lo < hi && s_begin > 0 && !(s_begin < s_end && offsets[s_begin] == lo)) {
+    const DiffType c = s_begin - 1;
+    const DiffType e = std::min(static_cast<DiffType>(offsets[c + 1]), hi);
+    T agg = identity;
+    for (DiffType i = lo; i < e; ++i) {
+      agg = f(agg, vals[i]);
+    }
+    carry_seg = c;
+    carry = agg;
+  }
+
+  for (DiffType s = s_begin; s < s_end; ++s) {
+    const DiffType e = std::min(static_cast<DiffType>(offsets[s + 1]), hi);
+    T agg = identity;
+    for (DiffType i = offsets[s]; i < e; ++i) {
+      agg = f(agg, vals[i]);
+    }
+    out[s] = agg;
+  }
+}
+
+/*!
+    \brief add the carries of later chunks into the last segment owned by
+           chunk, in order, if that segment continues past the chunk
+*/
+template <typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void reduce_chunk_fixup(OffIter offsets,
+                                    DiffType hi,
+                                    DiffType s_begin,
+                                    DiffType s_end,
+                                    OutIter out,
+                                    BinFn f,
+                                    DiffType num_chunks,
+                                    DiffType chunk,
+                                    const DiffType* carry_seg,
+                                    const T* carry)
+{
+  if (s_begin == s_end) {
+    return;
+  }
+  const DiffType s = s_end - 1;
+  if (!(hi < static_cast<DiffType>(offsets[s + 1]))) {
+    return;
+  }
+  T agg = out[s];
+  for (DiffType c = chunk + 1; c < num_chunks && carry_seg[c] == s; ++c) {
+    agg = f(agg, carry[c]);
+  }
+  out[s] = agg;
+}
+
+/*!
+    \brief inclusive segmented scan of [lo, hi) restarting at every head,
+           has_head tells if any segment starts in the chunk and tail is
+           the scan value of the last element
+*/
+template <typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void inclusive_chunk(Iter in,
+                                 HeadFn heads,
+                                 OutIter out,
+                                 BinFn f,
+                                 DiffType lo,
+                                 DiffType hi,
+                                 bool& has_head,
+                                 T& tail)
+{
+  T agg = in[lo];
+  out[lo] = agg;
+  has_head = heads(lo);
+  for (DiffType i = lo + 1; i < hi; ++i) {
+    if (heads(i)) {
+      agg = in[i];
+      has_head = true;
+    } else {
+      agg = f(agg, in[i]);
+    }
+    out[i] = agg;
+  }
+  tail = agg;
+}
+
+/*!
+    \brief exclusive segmented scan of [lo, hi) restarting from v at every
+           head, elements before the first head start from the identity
+*/
+template <typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void exclusive_chunk(Iter in,
+                                 HeadFn heads,
+                                 OutIter out,
+                                 BinFn f,
+                                 T v,
+                                 DiffType lo,
+                                 DiffType hi,
+                                 bool& has_head,
+                                 T& tail)
+{
+  T agg = BinFn::identity();
+  has_head = false;
+  for (DiffType i = lo; i < hi; ++i) {
+    auto t = in[i];
+    if (heads(i)) {
+      agg = v;
+      has_head = true;
+    }
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+  tail = agg;
+}
+
+/*!
+    \brief combine the carry from earlier chunks into the elements of
+           [lo, hi) that come before the first head
+*/
+template <typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void scan_chunk_fixup(HeadFn heads,
+                                  OutIter out,
+                                  BinFn f,
+                                  T carry,
+                                  DiffType lo,
+                                  DiffType hi)
+{
+  for (DiffType i = lo; i < hi && !heads(i); ++i) {
+    out[i] = f(carry, out[i]);
+  }
+}
+
+/*!
+    \brief count the heads in [lo, hi)
+*/
+template <typename HeadFn, typename DiffType>
+RAJA_INLINE DiffType count_heads(HeadFn heads, DiffType lo, DiffType hi)
+{
+  DiffType count = 0;
+  for (DiffType i = lo; i < hi; ++i) {
+    count += heads(i) ? 1 : 0;
+  }
+  return count;
+}
+
+/*!
+    \brief write the key and reduced value of each run starting in [lo, hi)
+           from position pos, and reduce the part of the run continuing into
+           the chunk from before into carry
+
+    A run that continues past hi only holds a partial value.
+*/
+template <typename KeyIter,
+          typename ValFn,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void reduce_by_key_chunk(KeyIter keys,
+                                     ValFn vals,
+                                     DiffType lo,
+                                     DiffType hi,
+                                     DiffType pos,
+                                     KeyOutIter keys_out,
+                                     ValOutIter vals_out,
+                                     BinFn f,
+                                     T& carry)
+{
+  const KeyHeads<KeyIter> heads{keys};
+
+  DiffType i = lo;
+  if (i < hi && !heads(i)) {
+    T agg = vals(i);
+    for (++i; i < hi && !heads(i); ++i) {
+      agg = f(agg, vals(i));
+    }
+    carry = agg;
+  }
+
+  while (i < hi) {
+    keys_out[pos] = keys[i];
+    T agg = vals(i);
+    for (++i; i < hi && !heads(i); ++i) {
+      agg = f(agg, vals(i));
+    }
+    vals_out[pos] = agg;
+    ++pos;
+  }
+}
+
+/*!
+    \brief add the carries of later chunks, in order, into the last run
+           written by chunk if that run continues past the chunk
+*/
+template <typename KeyIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+RAJA_INLINE void reduce_by_key_fixup(KeyIter keys,
+                                     DiffType n,
+                                     DiffType hi,
+                                     DiffType pos_end,
+                                     ValOutIter vals_out,
+                                     BinFn f,
+                                     DiffType num_chunks,
+                                     DiffType chunk,
+                                     const DiffType* head_counts,
+                                     const T* carry)
+{
+  const KeyHeads<KeyIter> heads{keys};
+
+  if (head_counts[chunk] == 0 || hi == n || heads(hi)) {
+    return;
+  }
+  T agg = vals_out[pos_end - 1];
+  for (DiffType c = chunk + 1; c < num_chunks; ++c) {
+    // a chunk that starts with a new run never wrote its carry
+    if (heads(RAJA::detail::firstIndex(n, num_chunks, c))) {
+      break;
+    }
+    agg = f(agg, carry[c]);
+    if (head_counts[c] != 0) {
+      break;
+    }
+  }
+  vals_out[pos_end - 1] = agg;
+}
+
+}  // namespace segmented
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
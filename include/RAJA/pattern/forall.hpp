@@ -197,12 +197,21 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res &r,
   return forall_impl(r, std::forward<ExecutionPolicy>(p), range, adapted);
 }
 
+}  // end namespace wrap
+
+namespace policy
+{
+namespace indexset
+{
+
 /*!
 ******************************************************************************
 *
 * \brief Execute segments from forall_Icount traversal method.
 *
-*         For usage example, see reducers.hxx.
+*         This is the default, found by argument dependent lookup on the
+*         ExecPolicy. Back-ends may overload forall_Icount_segments_impl
+*         for their segment iteration policies.
 *
 ******************************************************************************
 */
@@ -211,7 +220,7 @@ template <typename Res,
           typename SegmentExecPolicy,
           typename... SegmentTypes,
           typename LoopBody>
-RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res&r,
+RAJA_INLINE resources::EventProxy<Res> forall_Icount_segments_impl(Res &r,
                                                 ExecPolicy<SegmentIterPolicy,
                                                 SegmentExecPolicy>,
                                                 const TypedIndexSet<SegmentTypes...>& iset,
@@ -221,7 +230,7 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res&r,
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
     iset.segmentCall(segID,
-                     detail::CallForallIcount(iset.getStartingIcount(segID)),
+                     RAJA::detail::CallForallIcount(iset.getStartingIcount(segID)),
                      SegmentExecPolicy(),
                      loop_body,
                      r);
@@ -229,12 +238,23 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res&r,
   return RAJA::resources::EventProxy<Res>(&r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute segments from forall traversal method.
+*
+*         This is the default, found by argument dependent lookup on the
+*         ExecPolicy. Back-ends may overload forall_segments_impl for their
+*         segment iteration policies.
+*
+******************************************************************************
+*/
 template <typename Res,
           typename SegmentIterPolicy,
           typename SegmentExecPolicy,
-          typename LoopBody,
-          typename... SegmentTypes>
-RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE resources::EventProxy<Res> forall_segments_impl(Res &r,
                                          ExecPolicy<SegmentIterPolicy,
                                          SegmentExecPolicy>,
                                          const TypedIndexSet<SegmentTypes...>& iset,
@@ -242,11 +262,54 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
 {
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
-    iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), loop_body, r);
+    iset.segmentCall(segID, RAJA::detail::CallForall{}, SegmentExecPolicy(), loop_body, r);
   });
   return RAJA::resources::EventProxy<Res>(&r);
 }
 
+}  // end namespace indexset
+}  // end namespace policy
+
+namespace wrap
+{
+
+/*!
+******************************************************************************
+*
+* \brief Execute segments from forall_Icount traversal method.
+*
+*         For usage example, see reducers.hxx.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res&r,
+                                                ExecPolicy<SegmentIterPolicy,
+                                                SegmentExecPolicy> p,
+                                                const TypedIndexSet<SegmentTypes...>& iset,
+                                                LoopBody loop_body)
+{
+  return forall_Icount_segments_impl(r, p, iset, loop_body);
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall(Res &r,
+                                         ExecPolicy<SegmentIterPolicy,
+                                         SegmentExecPolicy> p,
+                                         const TypedIndexSet<SegmentTypes...>& iset,
+                                         LoopBody loop_body)
+{
+  return forall_segments_impl(r, p, iset, loop_body);
+}
+
 }  // end namespace wrap
 
 
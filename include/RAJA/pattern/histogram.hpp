@@ -0,0 +1,233 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter_add and histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_HPP
+#define RAJA_histogram_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  scatter add execution pattern, out[idx[i]] += vals[i] for each i
+*
+* \param[in] p Execution policy
+* \param[in] idx_begin Pointer or Random-Access Iterator to start of bin indices
+* \param[in] idx_end Pointer or Random-Access Iterator to end of bin indices
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[in,out] out Pointer or Random-Access Iterator to start of bins
+* \param[in] num_bins number of bins, every index must be in [0, num_bins)
+* \param[in] strategy how updates to the same bin are combined, by default
+* chosen from the number of updates, bins, and threads
+*
+* \note{Values are added to the existing contents of the bins. The order in
+*which values are added to a bin is unspecified.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValIter,
+          typename OutIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<IdxIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<OutIter>>
+scatter_add(const ExecPolicy &p,
+            IdxIter idx_begin,
+            IdxIter idx_end,
+            ValIter vals_begin,
+            OutIter out,
+            RAJA::detail::IterDiff<IdxIter> num_bins,
+            ScatterStrategy strategy = ScatterStrategy::automatic)
+{
+  static_assert(type_traits::is_random_access_iterator<IdxIter>::value,
+                "Index Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (idx_begin == idx_end) {
+    return;
+  }
+  impl::histogram::scatter_add(
+      p,
+      idx_begin,
+      idx_end - idx_begin,
+      RAJA::detail::IterValues<ValIter>{vals_begin},
+      out,
+      num_bins,
+      strategy);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern, counts[idx[i]] += 1 for each i
+*
+* \param[in] p Execution policy
+* \param[in] idx_begin Pointer or Random-Access Iterator to start of bin indices
+* \param[in] idx_end Pointer or Random-Access Iterator to end of bin indices
+*(exclusive)
+* \param[in,out] counts Pointer or Random-Access Iterator to start of bin counts
+* \param[in] num_bins number of bins, every index must be in [0, num_bins)
+* \param[in] strategy how updates to the same bin are combined, by default
+* chosen from the number of updates, bins, and threads
+*
+* \note{Counts are added to the existing contents of the bins.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename OutIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<IdxIter>,
+                    type_traits::is_iterator<OutIter>>
+histogram(const ExecPolicy &p,
+          IdxIter idx_begin,
+          IdxIter idx_end,
+          OutIter counts,
+          RAJA::detail::IterDiff<IdxIter> num_bins,
+          ScatterStrategy strategy = ScatterStrategy::automatic)
+{
+  using T = RAJA::detail::IterVal<OutIter>;
+  static_assert(type_traits::is_random_access_iterator<IdxIter>::value,
+                "Index Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (idx_begin == idx_end) {
+    return;
+  }
+  impl::histogram::scatter_add(p,
+                               idx_begin,
+                               idx_end - idx_begin,
+                               RAJA::detail::OneValues<T>{},
+                               counts,
+                               num_bins,
+                               strategy);
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  scatter add execution pattern, out[idx[i]] += vals[i] for each i
+*
+* \param[in] p Execution policy
+* \param[in] idx RandomAccess Container of bin indices
+* \param[in] vals RandomAccess Container of values, at least as long as idx
+* \param[in,out] out RandomAccess Container of bins
+* \param[in] strategy how updates to the same bin are combined
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IdxContainer,
+          typename ValContainer,
+          typename OutContainer>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<IdxContainer>,
+                    type_traits::is_range<ValContainer>,
+                    type_traits::is_range<OutContainer>>
+scatter_add(const ExecPolicy &p,
+            const IdxContainer &idx,
+            const ValContainer &vals,
+            OutContainer &out,
+            ScatterStrategy strategy = ScatterStrategy::automatic)
+{
+  static_assert(type_traits::is_random_access_range<IdxContainer>::value,
+                "IdxContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  scatter_add(p,
+              std::begin(idx),
+              std::end(idx),
+              std::begin(vals),
+              std::begin(out),
+              std::end(out) - std::begin(out),
+              strategy);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern, counts[idx[i]] += 1 for each i
+*
+* \param[in] p Execution policy
+* \param[in] idx RandomAccess Container of bin indices
+* \param[in,out] counts RandomAccess Container of bin counts
+* \param[in] strategy how updates to the same bin are combined
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IdxContainer,
+          typename OutContainer>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<IdxContainer>,
+                    type_traits::is_range<OutContainer>>
+histogram(const ExecPolicy &p,
+          const IdxContainer &idx,
+          OutContainer &counts,
+          ScatterStrategy strategy = ScatterStrategy::automatic)
+{
+  static_assert(type_traits::is_random_access_range<IdxContainer>::value,
+                "IdxContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  histogram(p,
+            std::begin(idx),
+            std::end(idx),
+            std::begin(counts),
+            std::end(counts) - std::begin(counts),
+            strategy);
+}
+
+// =============================================================================
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+scatter_add(Args &&... args)
+{
+  scatter_add(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+histogram(Args &&... args)
+{
+  histogram(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
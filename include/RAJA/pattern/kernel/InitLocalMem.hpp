@@ -20,14 +20,19 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/internal/TileMemPool_CPU.hpp"
+
 namespace RAJA
 {
 
 //Policies for RAJA local arrays
 struct cpu_tile_mem;
+struct cpu_pool_tile_mem;
+struct cpu_hugepage_tile_mem;
 
 
 namespace statement
@@ -52,6 +57,14 @@ template<camp::idx_t... Indices, typename... EnclosedStmts>
 struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
 };
 
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::cpu_pool_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::cpu_hugepage_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
 
 }  // end namespace statement
 
@@ -108,6 +121,74 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
 };
 
 
+//Statement executor to initalize RAJA local arrays in a reusable,
+//aligned per-thread tile buffer
+template<bool HugePages, typename Indices, typename StmtList, typename Types>
+struct PooledInitLocalMemExecutor;
+
+template<bool HugePages, camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct PooledInitLocalMemExecutor<HugePages, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types>{
+
+  //Number of bytes of the buffer used by a local array
+  template<camp::idx_t Pos, class Data>
+  static RAJA_INLINE size_t array_bytes(Data && data)
+  {
+    using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
+    static_assert(std::is_trivially_destructible<varType>::value,
+                  "pooled tile memory requires trivially destructible types");
+
+    return RAJA::detail::tile_mem_round_up(
+        camp::get<Pos>(data.param_tuple).size() * sizeof(varType));
+  }
+
+  //Execute statement list
+  template<class Data>
+  static void RAJA_INLINE exec_expanded(Data && data, char *)
+  {
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+
+  //Point local array at its part of the buffer
+  template<camp::idx_t Pos, camp::idx_t... others, class Data>
+  static void RAJA_INLINE exec_expanded(Data && data, char * buffer)
+  {
+    using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
+
+    camp::get<Pos>(data.param_tuple).set_data(reinterpret_cast<varType *>(buffer));
+
+    // Initialize others and execute
+    exec_expanded<others...>(data, buffer + array_bytes<Pos>(data));
+
+    // Cleanup and return
+    camp::get<Pos>(data.param_tuple).set_data(nullptr);
+  }
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    //Size the buffer for all the arrays at once
+    size_t nbytes = 0;
+    camp::sink((nbytes += array_bytes<Indices>(data))...);
+
+    RAJA::detail::TileMemScope buffer(nbytes, HugePages);
+
+    //Initalize local arrays + execute statements + cleanup
+    exec_expanded<Indices...>(data, buffer.get());
+  }
+
+};
+
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_pool_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>
+    : PooledInitLocalMemExecutor<false, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types> {
+};
+
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_hugepage_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>
+    : PooledInitLocalMemExecutor<true, camp::idx_seq<Indices...>, camp::list<EnclosedStmts...>, Types> {
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
@@ -0,0 +1,318 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for automatically choosing the loop order of a
+ *          RAJA::kernel nest of For statements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_LoopOrderSearch_HPP
+#define RAJA_pattern_kernel_LoopOrderSearch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/types.hpp"
+#include "RAJA/util/Permutations.hpp"
+
+#include "RAJA/pattern/kernel.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+constexpr camp::idx_t loop_order_factorial(camp::idx_t n)
+{
+  return n <= 1 ? 1 : n * loop_order_factorial(n - 1);
+}
+
+/*!
+ * Entry pos of the k-th permutation of 0..n-1 in lexicographic order.
+ */
+constexpr camp::idx_t nth_loop_order_entry(camp::idx_t n,
+                                           camp::idx_t k,
+                                           camp::idx_t pos)
+{
+  camp::idx_t used = 0;
+  camp::idx_t entry = 0;
+  for (camp::idx_t i = 0; i <= pos; ++i) {
+    camp::idx_t skip = (k / loop_order_factorial(n - 1 - i)) % (n - i);
+    for (entry = 0;; ++entry) {
+      if ((used >> entry) & 1) {
+        continue;
+      }
+      if (skip == 0) {
+        break;
+      }
+      --skip;
+    }
+    used |= camp::idx_t(1) << entry;
+  }
+  return entry;
+}
+
+template <typename Order>
+struct loop_order_size;
+
+template <camp::idx_t... Args>
+struct loop_order_size<camp::idx_seq<Args...>>
+    : std::integral_constant<size_t, sizeof...(Args)> {
+};
+
+template <camp::idx_t N, camp::idx_t K, typename Positions>
+struct nth_loop_order;
+
+template <camp::idx_t N, camp::idx_t K, camp::idx_t... Positions>
+struct nth_loop_order<N, K, camp::idx_seq<Positions...>> {
+  using type = camp::idx_seq<nth_loop_order_entry(N, K, Positions)...>;
+};
+
+template <camp::idx_t N, typename Ks>
+struct all_loop_orders;
+
+template <camp::idx_t N, camp::idx_t... Ks>
+struct all_loop_orders<N, camp::idx_seq<Ks...>> {
+  using type = camp::list<
+      typename nth_loop_order<N, Ks, camp::make_idx_seq_t<N>>::type...>;
+};
+
+/*!
+ * Nest of For statements over the arguments in Order, outermost first.
+ * The outermost loop uses OuterPolicy and the others use InnerPolicy.
+ */
+template <typename Order,
+          typename OuterPolicy,
+          typename InnerPolicy,
+          typename... EnclosedStmts>
+struct loop_order_nest;
+
+template <camp::idx_t Last,
+          typename OuterPolicy,
+          typename InnerPolicy,
+          typename... EnclosedStmts>
+struct loop_order_nest<camp::idx_seq<Last>,
+                       OuterPolicy,
+                       InnerPolicy,
+                       EnclosedStmts...> {
+  using type = statement::For<Last, OuterPolicy, EnclosedStmts...>;
+};
+
+template <camp::idx_t First,
+          camp::idx_t Second,
+          camp::idx_t... Rest,
+          typename OuterPolicy,
+          typename InnerPolicy,
+          typename... EnclosedStmts>
+struct loop_order_nest<camp::idx_seq<First, Second, Rest...>,
+                       OuterPolicy,
+                       InnerPolicy,
+                       EnclosedStmts...> {
+  using type = statement::For<
+      First,
+      OuterPolicy,
+      typename loop_order_nest<camp::idx_seq<Second, Rest...>,
+                               InnerPolicy,
+                               InnerPolicy,
+                               EnclosedStmts...>::type>;
+};
+
+}  // namespace detail
+
+/*!
+ * List of every loop order of an N deep loop nest, as the same kind of
+ * camp::idx_seq as the PERM_* permutations and in the same order, so
+ * all_loop_orders<3> is camp::list<PERM_IJK, PERM_IKJ, ..., PERM_KJI>.
+ */
+template <camp::idx_t N>
+using all_loop_orders = typename detail::all_loop_orders<
+    N,
+    camp::make_idx_seq_t<detail::loop_order_factorial(N)>>::type;
+
+/*!
+ * Chooses the fastest loop order of a nest of For statements by timing the
+ * candidates on the first launches of the kernel.
+ *
+ * Orders is a camp::list of loop orders, each a camp::idx_seq of kernel
+ * argument ids from the outermost loop to the innermost, for example
+ * all_loop_orders<3> or camp::list<PERM_IJK, PERM_KJI>. For each order the
+ * kernel policy
+ *
+ *   KernelPolicy<For<o0, OuterPolicy, For<o1, InnerPolicy, ...
+ *                  For<oN, InnerPolicy, EnclosedStmts...>...>>>
+ *
+ * is generated at compile time.
+ *
+ * Launches go through the kernel and kernel_param members, which take the
+ * same arguments as RAJA::kernel and RAJA::kernel_param. The first
+ * size(Orders) * trials launches cycle through the candidates and time each
+ * one, so they run with the real segments, views, and data layouts of the
+ * application. After that every launch uses the candidate with the lowest
+ * time. Every launch does the full work of the kernel, so the kernel must
+ * give the same result in any loop order.
+ *
+ * A LoopOrderSearch object is not thread safe, use one object per call site.
+ */
+template <typename Orders,
+          typename OuterPolicy,
+          typename InnerPolicy,
+          typename... EnclosedStmts>
+class LoopOrderSearch
+{
+  using order_idx_seq = camp::make_idx_seq_t<camp::size<Orders>::value>;
+
+public:
+  //! Number of loop orders searched
+  static constexpr size_t num_orders = camp::size<Orders>::value;
+
+  static_assert(num_orders > 0, "LoopOrderSearch needs at least one order");
+
+  //! Loop order of candidate K
+  template <camp::idx_t K>
+  using order = camp::at_v<Orders, K>;
+
+  //! Kernel policy of candidate K
+  template <camp::idx_t K>
+  using policy = KernelPolicy<typename detail::loop_order_nest<order<K>,
+                                                               OuterPolicy,
+                                                               InnerPolicy,
+                                                               EnclosedStmts...>::type>;
+
+  /*!
+   * Create a search that times every candidate trials times and keeps the
+   * fastest of its launches.
+   */
+  explicit LoopOrderSearch(size_t trials = 1)
+      : m_trials(trials > 0 ? trials : 1),
+        m_times(num_orders, std::numeric_limits<double>::max())
+  {
+  }
+
+  template <typename SegmentTuple, typename ParamTuple, typename... Bodies>
+  void kernel_param(SegmentTuple &&segments,
+                    ParamTuple &&params,
+                    Bodies &&... bodies)
+  {
+    if (is_tuned()) {
+      launch(m_best,
+             order_idx_seq{},
+             std::forward<SegmentTuple>(segments),
+             std::forward<ParamTuple>(params),
+             std::forward<Bodies>(bodies)...);
+      return;
+    }
+
+    const camp::idx_t k = static_cast<camp::idx_t>(m_launches % num_orders);
+
+    auto start = std::chrono::steady_clock::now();
+    launch(k,
+           order_idx_seq{},
+           std::forward<SegmentTuple>(segments),
+           std::forward<ParamTuple>(params),
+           std::forward<Bodies>(bodies)...);
+    auto stop = std::chrono::steady_clock::now();
+
+    const double time = std::chrono::duration<double>(stop - start).count();
+    if (time < m_times[k]) {
+      m_times[k] = time;
+    }
+
+    if (++m_launches == num_orders * m_trials) {
+      m_best = 0;
+      for (camp::idx_t i = 1; i < static_cast<camp::idx_t>(num_orders); ++i) {
+        if (m_times[i] < m_times[m_best]) {
+          m_best = i;
+        }
+      }
+    }
+  }
+
+  template <typename SegmentTuple, typename... Bodies>
+  void kernel(SegmentTuple &&segments, Bodies &&... bodies)
+  {
+    kernel_param(std::forward<SegmentTuple>(segments),
+                 RAJA::make_tuple(),
+                 std::forward<Bodies>(bodies)...);
+  }
+
+  //! True once every candidate has been timed
+  bool is_tuned() const { return m_best >= 0; }
+
+  //! Index of the chosen candidate in Orders, or -1 while still searching
+  camp::idx_t best() const { return m_best; }
+
+  //! Loop order of the chosen candidate, outermost first
+  std::array<Index_type, detail::loop_order_size<order<0>>::value> best_order() const
+  {
+    return get_order(m_best < 0 ? 0 : m_best, order_idx_seq{});
+  }
+
+  //! Fastest time in seconds measured for candidate k
+  double time(camp::idx_t k) const { return m_times[k]; }
+
+  //! Forget the measurements and search again from the next launch
+  void reset()
+  {
+    m_launches = 0;
+    m_best = -1;
+    m_times.assign(num_orders, std::numeric_limits<double>::max());
+  }
+
+private:
+  template <typename... Args>
+  static void launch(camp::idx_t, camp::idx_seq<>, Args &&...)
+  {
+  }
+
+  template <camp::idx_t K, camp::idx_t... Ks, typename... Args>
+  static void launch(camp::idx_t k, camp::idx_seq<K, Ks...>, Args &&... args)
+  {
+    if (k == K) {
+      RAJA::kernel_param<policy<K>>(std::forward<Args>(args)...);
+    } else {
+      launch(k, camp::idx_seq<Ks...>{}, std::forward<Args>(args)...);
+    }
+  }
+
+  static std::array<Index_type, detail::loop_order_size<order<0>>::value> get_order(
+      camp::idx_t, camp::idx_seq<>)
+  {
+    return {};
+  }
+
+  template <camp::idx_t K, camp::idx_t... Ks>
+  static std::array<Index_type, detail::loop_order_size<order<0>>::value> get_order(
+      camp::idx_t k, camp::idx_seq<K, Ks...>)
+  {
+    return k == K ? as_array<order<K>>::get()
+                  : get_order(k, camp::idx_seq<Ks...>{});
+  }
+
+  size_t m_trials;
+  size_t m_launches = 0;
+  camp::idx_t m_best = -1;
+  std::vector<double> m_times;
+};
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_LoopOrderSearch_HPP */
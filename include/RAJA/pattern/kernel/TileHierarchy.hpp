@@ -0,0 +1,288 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for multi-level tiling with tile sizes chosen from
+ *          the cache sizes of the CPU.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TileHierarchy_HPP
+#define RAJA_pattern_kernel_TileHierarchy_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/util/CacheInfo.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+///! target working set of a tiling level, Percent of the size of cache Level
+template <camp::idx_t Level, camp::idx_t Percent = 50>
+struct cache_target {
+  static constexpr camp::idx_t level = Level;
+  static constexpr camp::idx_t percent = Percent;
+};
+
+namespace detail
+{
+
+/*!
+ * Largest tile edge such that a tile of num_dims dimensions, where each
+ * iterate touches bytes_per_iterate bytes, fits in target_bytes.
+ * Edges of at least a cache line of elements are rounded down to whole
+ * cache lines.
+ */
+inline camp::idx_t cache_tile_size(double target_bytes,
+                                   camp::idx_t num_dims,
+                                   size_t bytes_per_iterate,
+                                   size_t elems_per_line)
+{
+  const double target = target_bytes / static_cast<double>(bytes_per_iterate);
+  camp::idx_t edge = static_cast<camp::idx_t>(
+      std::pow(target, 1.0 / static_cast<double>(num_dims)));
+
+  // correct rounding errors of pow
+  auto fits = [=](camp::idx_t e) {
+    return std::pow(static_cast<double>(e), static_cast<double>(num_dims)) <=
+           target;
+  };
+  while (edge > 1 && !fits(edge)) {
+    --edge;
+  }
+  while (fits(edge + 1)) {
+    ++edge;
+  }
+
+  const camp::idx_t line = static_cast<camp::idx_t>(elems_per_line);
+  if (line > 1 && edge >= line) {
+    edge = edge / line * line;
+  }
+  return edge < 1 ? 1 : edge;
+}
+
+}  // namespace detail
+
+/*!
+ * Tile policy for a Tile statement with a tile size chosen at run time,
+ * so that a NumDims dimensional tile, where each iterate touches NumArrays
+ * elements of type T, fits the cache target Target.
+ *
+ * The size is computed from get_cache_info() the first time it is used.
+ */
+template <typename Target,
+          camp::idx_t NumDims,
+          typename T,
+          camp::idx_t NumArrays = 1>
+struct tile_cache {
+
+  static camp::idx_t get_size()
+  {
+    static const camp::idx_t size = compute_size();
+    return size;
+  }
+
+private:
+  static camp::idx_t compute_size()
+  {
+    const CacheInfo& info = get_cache_info();
+    const double target =
+        static_cast<double>(info.level_size(Target::level)) *
+        static_cast<double>(Target::percent) / 100.0;
+    return detail::cache_tile_size(target,
+                                   NumDims,
+                                   sizeof(T) * NumArrays,
+                                   info.line_size / sizeof(T));
+  }
+};
+
+namespace internal
+{
+
+template <camp::idx_t ArgumentId, typename TilePolicy>
+struct tile_step {
+};
+
+template <typename... Lists>
+struct concat_tile_steps;
+
+template <typename... Steps>
+struct concat_tile_steps<camp::list<Steps...>> {
+  using type = camp::list<Steps...>;
+};
+
+template <typename... Steps0, typename... Steps1, typename... Lists>
+struct concat_tile_steps<camp::list<Steps0...>,
+                         camp::list<Steps1...>,
+                         Lists...> {
+  using type = typename concat_tile_steps<camp::list<Steps0..., Steps1...>,
+                                          Lists...>::type;
+};
+
+/*!
+ * Tile every argument in Args for every target in Targets, the targets
+ * from outermost to innermost.
+ */
+template <typename Args, typename Targets, typename T, camp::idx_t NumArrays>
+struct tile_hierarchy_steps;
+
+template <camp::idx_t... Args,
+          typename... Targets,
+          typename T,
+          camp::idx_t NumArrays>
+struct tile_hierarchy_steps<camp::idx_seq<Args...>,
+                            camp::list<Targets...>,
+                            T,
+                            NumArrays> {
+  template <typename Target>
+  using level = camp::list<tile_step<
+      Args,
+      tile_cache<Target, sizeof...(Args), T, NumArrays>>...>;
+
+  using type = typename concat_tile_steps<level<Targets>...>::type;
+};
+
+/*!
+ * Nest of Tile statements, the outermost uses ExecPolicy and the others
+ * are sequential.
+ */
+template <typename Steps, typename ExecPolicy, typename... EnclosedStmts>
+struct tile_step_nest;
+
+template <camp::idx_t ArgumentId,
+          typename TilePolicy,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct tile_step_nest<camp::list<tile_step<ArgumentId, TilePolicy>>,
+                      ExecPolicy,
+                      EnclosedStmts...> {
+  using type =
+      statement::Tile<ArgumentId, TilePolicy, ExecPolicy, EnclosedStmts...>;
+};
+
+template <camp::idx_t ArgumentId,
+          typename TilePolicy,
+          typename NextStep,
+          typename... Steps,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct tile_step_nest<
+    camp::list<tile_step<ArgumentId, TilePolicy>, NextStep, Steps...>,
+    ExecPolicy,
+    EnclosedStmts...> {
+  using type = statement::Tile<
+      ArgumentId,
+      TilePolicy,
+      ExecPolicy,
+      typename tile_step_nest<camp::list<NextStep, Steps...>,
+                              RAJA::loop_exec,
+                              EnclosedStmts...>::type>;
+};
+
+}  // namespace internal
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that tiles the arguments in Args once for each
+ * cache level in Targets, a camp::list of cache_target from outermost to
+ * innermost, for example
+ *
+ *   TileHierarchy<ArgList<1, 0>,
+ *                 camp::list<cache_target<2>, cache_target<1>>,
+ *                 double, 3, omp_parallel_for_exec,
+ *                 For<1, loop_exec, For<0, loop_exec, Lambda<0>>>>
+ *
+ * tiles a 2D nest for half of the L2 cache and, inside that, for half of
+ * the L1 cache, assuming each iterate touches 3 doubles. All the arguments
+ * of a level use the same tile size, computed from the cache sizes of the
+ * machine the first time the kernel runs, so one binary blocks well on
+ * every node type.
+ *
+ * The outermost tile loop uses ExecPolicy and the others are sequential.
+ */
+template <typename Args,
+          typename Targets,
+          typename T,
+          camp::idx_t NumArrays,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+using TileHierarchy = typename internal::tile_step_nest<
+    typename internal::tile_hierarchy_steps<Args, Targets, T, NumArrays>::type,
+    ExecPolicy,
+    EnclosedStmts...>::type;
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * A generic RAJA::kernel forall_impl executor for statement::Tile with a
+ * tile size chosen from the cache sizes
+ */
+template <camp::idx_t ArgumentId,
+          typename Target,
+          camp::idx_t NumDims,
+          typename T,
+          camp::idx_t NumArrays,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Tile<ArgumentId,
+                    tile_cache<Target, NumDims, T, NumArrays>,
+                    EPol,
+                    EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
+
+    // Get the tile size for this machine
+    auto chunk_size = tile_cache<Target, NumDims, T, NumArrays>::get_size();
+
+    // Create a tile iterator, needs to survive until the forall is
+    // done executing.
+    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+
+    // Wrap in case forall_impl needs to thread_privatize
+    TileWrapper<ArgumentId, Data, Types, EnclosedStmts...> tile_wrapper(data);
+
+    // Loop over tiles, executing enclosed statement list
+    auto r = resources::get_resource<EPol>::type::get_default();
+    forall_impl(r, EPol{}, tiled_iterable, tile_wrapper);
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = tiled_iterable.it;
+  }
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TileHierarchy_HPP */
@@ -132,6 +132,9 @@ struct LoopData {
   RAJA_HOST_DEVICE RAJA_INLINE void assign_offset(IndexT const &i)
   {
     camp::get<Idx>(offset_tuple) = i;
+    assign_param_offsets<Idx>(
+        i,
+        camp::make_idx_seq_t<camp::tuple_size<param_tuple_t>::value>{});
   }
 
   template <typename ParamId, typename IndexT>
@@ -149,6 +152,40 @@ struct LoopData {
     return camp::get<ParamId::param_idx>(param_tuple);
   }
 
+private:
+  /*!
+   * Parameters that follow the loop arguments, like a ViewCursor, have an
+   * assign_offset<Idx>(segment, offset) method and are told of each new
+   * offset. Other parameters are left alone, at no cost.
+   */
+  template <camp::idx_t Idx, typename IndexT, camp::idx_t... ParamIdx>
+  RAJA_HOST_DEVICE RAJA_INLINE void assign_param_offsets(
+      IndexT const &i,
+      camp::idx_seq<ParamIdx...> const &)
+  {
+    camp::sink(assign_param_offset<Idx>(
+        camp::get<ParamIdx>(param_tuple), camp::get<Idx>(segment_tuple), i, 0)...);
+  }
+
+  template <camp::idx_t Idx, typename Param, typename Segment, typename IndexT>
+  RAJA_HOST_DEVICE RAJA_INLINE static auto assign_param_offset(
+      Param &param,
+      Segment const &segment,
+      IndexT const &i,
+      int) -> decltype(param.template assign_offset<Idx>(segment, i), 0)
+  {
+    param.template assign_offset<Idx>(segment, i);
+    return 0;
+  }
+
+  template <camp::idx_t Idx, typename Param, typename Segment, typename IndexT>
+  RAJA_HOST_DEVICE RAJA_INLINE static int assign_param_offset(Param &,
+                                                              Segment const &,
+                                                              IndexT const &,
+                                                              long)
+  {
+    return 0;
+  }
 
 };
 
@@ -195,6 +195,112 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, begin, end, out, binop, value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan execution pattern with an input transform
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input before it is scanned
+* \param[in] binop binary function to apply for scan
+*
+* \note{unop is applied as each input is read, so no transformed copy of the
+*input is made. [begin, end) may be the same range as [out, out + (end -
+*begin)), but must not partially overlap it}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryFunction,
+          typename Function =
+              operators::plus<RAJA::detail::TransformVal<UnaryFunction, Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using T = RAJA::detail::IterVal<Iter>;
+  using U = RAJA::detail::TransformVal<UnaryFunction, Iter>;
+  static_assert(type_traits::is_unary_function<UnaryFunction, U, T>::value,
+                "UnaryFunction must model UnaryFunction");
+  static_assert(type_traits::is_binary_function<Function, R, U, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform_inclusive(p, begin, end, out, binop, unop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan execution pattern with an input transform
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input before it is scanned
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* \note{unop is applied as each input is read, so no transformed copy of the
+*input is made. [begin, end) may be the same range as [out, out + (end -
+*begin)), but must not partially overlap it}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryFunction,
+          typename T = RAJA::detail::TransformVal<UnaryFunction, Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using V = RAJA::detail::IterVal<Iter>;
+  using U = RAJA::detail::TransformVal<UnaryFunction, Iter>;
+  static_assert(type_traits::is_unary_function<UnaryFunction, U, V>::value,
+                "UnaryFunction must model UnaryFunction");
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::scan::transform_exclusive(p, begin, end, out, binop, unop, value);
+}
+
 // =============================================================================
 
 /*!
@@ -349,6 +455,100 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan execution pattern with an input transform
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input before it is scanned
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename UnaryFunction,
+          typename Function = operators::plus<RAJA::detail::TransformVal<
+              UnaryFunction,
+              camp::iterator_from<Container>>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using U = RAJA::detail::TransformVal<UnaryFunction,
+                                       camp::iterator_from<Container>>;
+  static_assert(type_traits::is_binary_function<Function, R, U, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::scan::transform_inclusive(
+      p, std::begin(c), std::end(c), out, binop, unop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan execution pattern with an input transform
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input before it is scanned
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename UnaryFunction,
+          typename T = RAJA::detail::
+              TransformVal<UnaryFunction, camp::iterator_from<Container>>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         IterOut out,
+                         UnaryFunction unop,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using U = RAJA::detail::TransformVal<UnaryFunction,
+                                       camp::iterator_from<Container>>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (std::begin(c) == std::end(c)) {
+    return;
+  }
+  impl::scan::transform_exclusive(
+      p, std::begin(c), std::end(c), out, binop, unop, value);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 exclusive_scan(Args &&... args)
@@ -377,6 +577,20 @@ inclusive_scan_inplace(Args &&... args)
   inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_exclusive_scan(Args &&... args)
+{
+  transform_exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_inclusive_scan(Args &&... args)
+{
+  transform_inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,604 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce and scan, reduce by
+*          key, and run length encode declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_HPP
+#define RAJA_segmented_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/segmented.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduce execution pattern, reduces each segment
+*         [offsets[s], offsets[s+1]) of the values into out[s]
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+*segment offsets into the data range, in non-decreasing order
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of segment
+*offsets (exclusive), there is one more offset than segments
+* \param[out] out Pointer or Random-Access Iterator to start of per-segment
+*output
+* \param[in] binop binary function to apply for reduce
+* \param[in] value identity for binary function, binop, empty segments are
+*set to this value
+*
+* \note{The work is balanced over the values, not the segments, so a few very
+*long segments do not serialize the reduction.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffIter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffIter>,
+                    type_traits::is_iterator<IterOut>>
+segmented_reduce(const ExecPolicy &p,
+                 Iter begin,
+                 OffIter offsets_begin,
+                 OffIter offsets_end,
+                 IterOut out,
+                 Function binop = Function{},
+                 T value = Function::identity())
+{
+  using U = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, T, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffIter>::value,
+                "Offsets Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (offsets_end - offsets_begin < 2) {
+    return;
+  }
+  impl::segmented::reduce(p,
+                          begin,
+                          offsets_begin,
+                          (offsets_end - offsets_begin) - 1,
+                          out,
+                          binop,
+                          value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented inclusive scan execution pattern, scans each run of
+*         equal keys independently
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] keys Pointer or Random-Access Iterator to start of segment keys,
+*a segment starts wherever a key differs from the one before it
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename KeyIter,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<IterOut>>
+segmented_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         KeyIter keys,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using T = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::segmented::inclusive(p,
+                             begin,
+                             end - begin,
+                             RAJA::detail::segmented::KeyHeads<KeyIter>{keys},
+                             out,
+                             binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented exclusive scan execution pattern, scans each run of
+*         equal keys independently
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] keys Pointer or Random-Access Iterator to start of segment keys,
+*a segment starts wherever a key differs from the one before it
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+* \note{The range of [begin, end) must be separate from [out, out + dist (begin,
+*end))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename KeyIter,
+          typename IterOut,
+          typename T = RAJA::detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<IterOut>>
+segmented_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         KeyIter keys,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = RAJA::detail::IterVal<IterOut>;
+  using U = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return;
+  }
+  impl::segmented::exclusive(p,
+                             begin,
+                             end - begin,
+                             RAJA::detail::segmented::KeyHeads<KeyIter>{keys},
+                             out,
+                             binop,
+                             value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern, reduces each run of equal keys to
+*         one key and value
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+*(exclusive)
+* \param[in] vals_begin Pointer or Random-Access Iterator to start of values
+* \param[out] keys_out Pointer or Random-Access Iterator to start of the key
+*of each run
+* \param[out] vals_out Pointer or Random-Access Iterator to start of the
+*reduced value of each run
+* \param[in] binop binary function to apply for reduce
+*
+* \return the number of runs written to keys_out and vals_out
+*
+* \note{Keys are compared with ==, so sort keys first, e.g. with sort_pairs,
+*to reduce all values with equal keys together.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename Function = operators::plus<RAJA::detail::IterVal<ValIter>>>
+concepts::enable_if_t<RAJA::detail::IterDiff<KeyIter>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<KeyIter>,
+                      type_traits::is_iterator<ValIter>,
+                      type_traits::is_iterator<KeyOutIter>,
+                      type_traits::is_iterator<ValOutIter>>
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              ValIter vals_begin,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              Function binop = Function{})
+{
+  using R = RAJA::detail::IterVal<ValOutIter>;
+  using T = RAJA::detail::IterVal<ValIter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Values Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyOutIter>::value,
+                "Keys Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValOutIter>::value,
+                "Values Output Iterator must model RandomAccessIterator");
+  if (keys_begin == keys_end) {
+    return 0;
+  }
+  return impl::segmented::reduce_by_key(
+      p,
+      keys_begin,
+      keys_end - keys_begin,
+      RAJA::detail::IterValues<ValIter>{vals_begin},
+      keys_out,
+      vals_out,
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  run length encode execution pattern, writes the value and length of
+*         each run of equal values
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] unique_out Pointer or Random-Access Iterator to start of the
+*value of each run
+* \param[out] counts_out Pointer or Random-Access Iterator to start of the
+*length of each run
+*
+* \return the number of runs written to unique_out and counts_out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename CountIter>
+concepts::enable_if_t<RAJA::detail::IterDiff<Iter>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_iterator<Iter>,
+                      type_traits::is_iterator<IterOut>,
+                      type_traits::is_iterator<CountIter>>
+run_length_encode(const ExecPolicy &p,
+                  Iter begin,
+                  Iter end,
+                  IterOut unique_out,
+                  CountIter counts_out)
+{
+  using C = RAJA::detail::IterVal<CountIter>;
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<CountIter>::value,
+                "Counts Output Iterator must model RandomAccessIterator");
+  if (begin == end) {
+    return 0;
+  }
+  return impl::segmented::reduce_by_key(p,
+                                        begin,
+                                        end - begin,
+                                        RAJA::detail::OneValues<C>{},
+                                        unique_out,
+                                        counts_out,
+                                        operators::plus<C>{});
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduce execution pattern, reduces each segment
+*         [offsets[s], offsets[s+1]) of the values into out[s]
+*
+* \param[in] p Execution policy
+* \param[in] c RandomAccess Container of values
+* \param[in] offsets RandomAccess Container of segment offsets, there is one
+*more offset than segments
+* \param[out] out RandomAccess Container of per-segment output
+* \param[in] binop binary function to apply for reduce
+* \param[in] value identity for binary function, binop
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename OffContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_range<OffContainer>,
+                    type_traits::is_range<OutContainer>>
+segmented_reduce(const ExecPolicy &p,
+                 const Container &c,
+                 const OffContainer &offsets,
+                 OutContainer &out,
+                 Function binop = Function{},
+                 T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OffContainer>::value,
+                "OffContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  segmented_reduce(p,
+                   std::begin(c),
+                   std::begin(offsets),
+                   std::end(offsets),
+                   std::begin(out),
+                   binop,
+                   value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented inclusive scan execution pattern, scans each run of
+*         equal keys independently
+*
+* \param[in] p Execution policy
+* \param[in] c RandomAccess Container of values
+* \param[in] keys RandomAccess Container of segment keys
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename KeyContainer,
+          typename IterOut,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_iterator<IterOut>>
+segmented_inclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         const KeyContainer &keys,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  segmented_inclusive_scan(
+      p, std::begin(c), std::end(c), std::begin(keys), out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented exclusive scan execution pattern, scans each run of
+*         equal keys independently
+*
+* \param[in] p Execution policy
+* \param[in] c RandomAccess Container of values
+* \param[in] keys RandomAccess Container of segment keys
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename KeyContainer,
+          typename IterOut,
+          typename T = RAJA::detail::ContainerVal<Container>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_iterator<IterOut>>
+segmented_exclusive_scan(const ExecPolicy &p,
+                         const Container &c,
+                         const KeyContainer &keys,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  segmented_exclusive_scan(
+      p, std::begin(c), std::end(c), std::begin(keys), out, binop, value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern, reduces each run of equal keys to
+*         one key and value
+*
+* \param[in] p Execution policy
+* \param[in] keys RandomAccess Container of keys
+* \param[in] vals RandomAccess Container of values
+* \param[out] keys_out RandomAccess Container of the key of each run
+* \param[out] vals_out RandomAccess Container of the reduced value of each run
+* \param[in] binop binary function to apply for reduce
+*
+* \return the number of runs written to keys_out and vals_out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename ValContainer,
+          typename KeyOutContainer,
+          typename ValOutContainer,
+          typename Function =
+              operators::plus<RAJA::detail::ContainerVal<ValContainer>>>
+concepts::enable_if_t<RAJA::detail::IterDiff<camp::iterator_from<KeyContainer>>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<ValContainer>,
+                      type_traits::is_range<KeyOutContainer>,
+                      type_traits::is_range<ValOutContainer>>
+reduce_by_key(const ExecPolicy &p,
+              const KeyContainer &keys,
+              const ValContainer &vals,
+              KeyOutContainer &keys_out,
+              ValOutContainer &vals_out,
+              Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<KeyOutContainer>::value,
+                "KeyOutContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValOutContainer>::value,
+                "ValOutContainer must model RandomAccessRange");
+  return reduce_by_key(p,
+                       std::begin(keys),
+                       std::end(keys),
+                       std::begin(vals),
+                       std::begin(keys_out),
+                       std::begin(vals_out),
+                       binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  run length encode execution pattern, writes the value and length of
+*         each run of equal values
+*
+* \param[in] p Execution policy
+* \param[in] c RandomAccess Container of values
+* \param[out] unique_out RandomAccess Container of the value of each run
+* \param[out] counts_out RandomAccess Container of the length of each run
+*
+* \return the number of runs written to unique_out and counts_out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename OutContainer,
+          typename CountContainer>
+concepts::enable_if_t<RAJA::detail::IterDiff<camp::iterator_from<Container>>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      type_traits::is_range<OutContainer>,
+                      type_traits::is_range<CountContainer>>
+run_length_encode(const ExecPolicy &p,
+                  const Container &c,
+                  OutContainer &unique_out,
+                  CountContainer &counts_out)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<CountContainer>::value,
+                "CountContainer must model RandomAccessRange");
+  return run_length_encode(p,
+                           std::begin(c),
+                           std::end(c),
+                           std::begin(unique_out),
+                           std::begin(counts_out));
+}
+
+// =============================================================================
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_reduce(Args &&... args)
+{
+  segmented_reduce(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_inclusive_scan(Args &&... args)
+{
+  segmented_inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_exclusive_scan(Args &&... args)
+{
+  segmented_exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if_t<decltype(reduce_by_key(ExecPolicy{},
+                                             std::declval<Args>()...)),
+                      type_traits::is_execution_policy<ExecPolicy>>
+reduce_by_key(Args &&... args)
+{
+  return reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if_t<decltype(run_length_encode(ExecPolicy{},
+                                                 std::declval<Args>()...)),
+                      type_traits::is_execution_policy<ExecPolicy>>
+run_length_encode(Args &&... args)
+{
+  return run_length_encode(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -93,6 +93,80 @@ stable_sort(const ExecPolicy &p,
   impl::sort::stable(p, begin, end, comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern with scratch memory allocator
+*
+* Back-ends that need scratch memory allocate it with a copy of
+* scratch_allocator rebound to the item type, others ignore it.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for sort
+* \param[in] scratch_allocator Allocator for scratch memory
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare,
+          typename Allocator>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+sort(const ExecPolicy &p,
+     Iter begin,
+     Iter end,
+     Compare comp,
+     Allocator const& scratch_allocator)
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::unstable(p, begin, end, comp, scratch_allocator);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern with scratch memory allocator
+*
+* Back-ends that need scratch memory allocate it with a copy of
+* scratch_allocator rebound to the item type, others ignore it.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for stable_sort
+* \param[in] scratch_allocator Allocator for scratch memory
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare,
+          typename Allocator>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+stable_sort(const ExecPolicy &p,
+            Iter begin,
+            Iter end,
+            Compare comp,
+            Allocator const& scratch_allocator)
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::stable(p, begin, end, comp, scratch_allocator);
+}
+
 /*!
 ******************************************************************************
 *
@@ -165,6 +239,350 @@ stable_sort_pairs(const ExecPolicy &p,
   impl::sort::stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  sort by key execution pattern
+*
+* Sorts the keys and reorders any number of value ranges the same way. The
+* keys are sorted together with an index permutation, 32 bits wide when the
+* range is small enough, and each value range is reordered afterwards with
+* one gather, so the sort does not move the values.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in] comp comparison function to apply for sort
+* \param[in,out] vals_begins Pointers or Random-Access Iterators to start of data values ranges
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Compare,
+          typename... ValIters>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    concepts::negate<type_traits::is_iterator<Compare>>,
+                    type_traits::is_iterator<ValIters>...>
+sort_by_key(const ExecPolicy &p,
+            KeyIter keys_begin,
+            KeyIter keys_end,
+            Compare comp,
+            ValIters... vals_begins)
+{
+  using R = RAJA::detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(concepts::all_of<type_traits::is_random_access_iterator<ValIters>...>::value,
+                "Vals Iterators must model RandomAccessIterator");
+  impl::sort::unstable_by_key(p, keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort by key execution pattern, ordering the keys with operators::less
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in,out] vals_begins Pointers or Random-Access Iterators to start of data values ranges
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename... ValIters>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIters>...>
+sort_by_key(const ExecPolicy &p,
+            KeyIter keys_begin,
+            KeyIter keys_end,
+            ValIters... vals_begins)
+{
+  sort_by_key(p,
+              keys_begin,
+              keys_end,
+              operators::less<RAJA::detail::IterVal<KeyIter>>{},
+              vals_begins...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort by key execution pattern
+*
+* Like sort_by_key, keeping the order of equivalent keys.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in] comp comparison function to apply for stable_sort
+* \param[in,out] vals_begins Pointers or Random-Access Iterators to start of data values ranges
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Compare,
+          typename... ValIters>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    concepts::negate<type_traits::is_iterator<Compare>>,
+                    type_traits::is_iterator<ValIters>...>
+stable_sort_by_key(const ExecPolicy &p,
+                   KeyIter keys_begin,
+                   KeyIter keys_end,
+                   Compare comp,
+                   ValIters... vals_begins)
+{
+  using R = RAJA::detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(concepts::all_of<type_traits::is_random_access_iterator<ValIters>...>::value,
+                "Vals Iterators must model RandomAccessIterator");
+  impl::sort::stable_by_key(p, keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort by key execution pattern, ordering the keys with operators::less
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] keys_end Pointer or Random-Access Iterator to end of data keys range
+* \param[in,out] vals_begins Pointers or Random-Access Iterators to start of data values ranges
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename... ValIters>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIters>...>
+stable_sort_by_key(const ExecPolicy &p,
+                   KeyIter keys_begin,
+                   KeyIter keys_end,
+                   ValIters... vals_begins)
+{
+  stable_sort_by_key(p,
+                     keys_begin,
+                     keys_end,
+                     operators::less<RAJA::detail::IterVal<KeyIter>>{},
+                     vals_begins...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partial sort execution pattern
+*
+* Sorts the smallest middle-begin items of the range into [begin, middle),
+* the order of the items in [middle, end) is unspecified.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] middle Pointer or Random-Access Iterator to end of sorted part
+* of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for partial_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+partial_sort(const ExecPolicy &p,
+             Iter begin,
+             Iter middle,
+             Iter end,
+             Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::partial(p, begin, middle, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  nth element execution pattern
+*
+* Puts the item that would be at nth if the range were sorted at nth, with
+* no greater items before it and no lesser items after it.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] nth Pointer or Random-Access Iterator to item to select
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function to apply for nth_element
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+nth_element(const ExecPolicy &p,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::nth_element(p, begin, nth, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  top k execution pattern
+*
+* Copies the min(k, end-begin) smallest items of the range into out in
+* sorted order, the range is not modified.
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] k number of items to copy
+* \param[out] out Pointer or Random-Access Iterator to start of output range
+* \param[in] comp comparison function to apply for top_k
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OutIter>>
+top_k(const ExecPolicy &p,
+      Iter begin,
+      Iter end,
+      RAJA::detail::IterDiff<Iter> k,
+      OutIter out,
+      Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OutIter>::value,
+                "Output Iterator must model RandomAccessIterator");
+  impl::sort::top_k(p, begin, end, k, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented sort execution pattern
+*
+* Sorts each segment [begin + offsets[s], begin + offsets[s+1]) of the range
+* independently, segments are sorted in parallel with each other.
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+* segment offsets, holding one more offset than there are segments
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of segment
+* offsets (exclusive)
+* \param[in] comp comparison function to apply for segmented_sort
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>>
+segmented_sort(const ExecPolicy &p,
+               Iter begin,
+               OffsetIter offsets_begin,
+               OffsetIter offsets_end,
+               Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offsets Iterator must model RandomAccessIterator");
+  impl::sort::unstable_segmented(p, begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  segmented sort pairs execution pattern
+*
+* Like segmented_sort, reordering the values along with the keys.
+*
+* \param[in] p Execution policy
+* \param[in,out] keys_begin Pointer or Random-Access Iterator to start of data keys range
+* \param[in,out] vals_begin Pointer or Random-Access Iterator to start of data values range
+* \param[in] offsets_begin Pointer or Random-Access Iterator to start of
+* segment offsets, holding one more offset than there are segments
+* \param[in] offsets_end Pointer or Random-Access Iterator to end of segment
+* offsets (exclusive)
+* \param[in] comp comparison function to apply to keys for segmented_sort_pairs
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename OffsetIter,
+          typename Compare = operators::less<RAJA::detail::IterVal<KeyIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValIter>,
+                    type_traits::is_iterator<OffsetIter>>
+segmented_sort_pairs(const ExecPolicy &p,
+                     KeyIter keys_begin,
+                     ValIter vals_begin,
+                     OffsetIter offsets_begin,
+                     OffsetIter offsets_end,
+                     Compare comp = Compare{})
+{
+  using R = RAJA::detail::IterVal<KeyIter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Keys Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<ValIter>::value,
+                "Vals Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offsets Iterator must model RandomAccessIterator");
+  impl::sort::unstable_segmented_pairs(p, keys_begin, vals_begin,
+                                       offsets_begin, offsets_end, comp);
+}
+
 
 // =============================================================================
 
@@ -296,6 +714,134 @@ stable_sort_pairs(const ExecPolicy &p,
   impl::sort::stable_pairs(p, std::begin(keys), std::end(keys), std::begin(vals), comp);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  sort by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in] comp comparison function to apply to keys for sort
+* \param[in,out] vals RandomAccess Containers or ranges of values to reorder
+* along with keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename Compare,
+          typename... ValContainers>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    concepts::negate<type_traits::is_range<Compare>>,
+                    type_traits::is_range<ValContainers>...>
+sort_by_key(const ExecPolicy &p,
+            KeyContainer &keys,
+            Compare comp,
+            ValContainers &... vals)
+{
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(concepts::all_of<type_traits::is_random_access_range<ValContainers>...>::value,
+                "ValContainers must model RandomAccessRange");
+  impl::sort::unstable_by_key(p, std::begin(keys), std::end(keys), comp, std::begin(vals)...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort by key execution pattern, ordering the keys with operators::less
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] vals RandomAccess Containers or ranges of values to reorder
+* along with keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename... ValContainers>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainers>...>
+sort_by_key(const ExecPolicy &p,
+            KeyContainer &keys,
+            ValContainers &... vals)
+{
+  sort_by_key(p,
+              keys,
+              operators::less<RAJA::detail::ContainerVal<KeyContainer>>{},
+              vals...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in] comp comparison function to apply to keys for stable_sort
+* \param[in,out] vals RandomAccess Containers or ranges of values to reorder
+* along with keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename Compare,
+          typename... ValContainers>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    concepts::negate<type_traits::is_range<Compare>>,
+                    type_traits::is_range<ValContainers>...>
+stable_sort_by_key(const ExecPolicy &p,
+                   KeyContainer &keys,
+                   Compare comp,
+                   ValContainers &... vals)
+{
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(concepts::all_of<type_traits::is_random_access_range<ValContainers>...>::value,
+                "ValContainers must model RandomAccessRange");
+  impl::sort::stable_by_key(p, std::begin(keys), std::end(keys), comp, std::begin(vals)...);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort by key execution pattern, ordering the keys with operators::less
+*
+* \param[in] p Execution policy
+* \param[in,out] keys RandomAccess Container or range of keys to be sorted
+* \param[in,out] vals RandomAccess Containers or ranges of values to reorder
+* along with keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename... ValContainers>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainers>...>
+stable_sort_by_key(const ExecPolicy &p,
+                   KeyContainer &keys,
+                   ValContainers &... vals)
+{
+  stable_sort_by_key(p,
+                     keys,
+                     operators::less<RAJA::detail::ContainerVal<KeyContainer>>{},
+                     vals...);
+}
+
 
 // =============================================================================
 
@@ -327,6 +873,55 @@ stable_sort_pairs(Args &&... args)
   stable_sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+sort_by_key(Args &&... args)
+{
+  sort_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+stable_sort_by_key(Args &&... args)
+{
+  stable_sort_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+partial_sort(Args &&... args)
+{
+  partial_sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+nth_element(Args &&... args)
+{
+  nth_element(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+top_k(Args &&... args)
+{
+  top_k(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_sort(Args &&... args)
+{
+  segmented_sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+segmented_sort_pairs(Args &&... args)
+{
+  segmented_sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -18,6 +18,8 @@
 #ifndef RAJA_pattern_teams_core_HPP
 #define RAJA_pattern_teams_core_HPP
 
+#include <cstddef>
+
 #include "RAJA/config.hpp"
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
@@ -132,12 +134,16 @@ public:
   Teams teams;
   Threads threads;
   Lanes lanes;
+  //! bytes of team-shared memory handed out by getSharedMemory
+  size_t shared_mem_size = 0;
 
   RAJA_INLINE
   Resources() = default;
 
-  Resources(Teams in_teams, Threads in_threads)
-      : teams(in_teams), threads(in_threads){};
+  Resources(Teams in_teams, Threads in_threads, size_t in_shared_mem_size = 0)
+      : teams(in_teams),
+        threads(in_threads),
+        shared_mem_size(in_shared_mem_size){};
 
 private:
   RAJA_HOST_DEVICE
@@ -159,6 +165,21 @@ class LaunchContext : public Resources
 public:
   ExecPlace exec_place;
 
+  //
+  // Host team of this thread, set by host launch policies that run several
+  // teams at once; a single team of one thread otherwise.
+  //
+  int host_team = 0;
+  int host_num_teams = 1;
+  int host_thread = 0;
+  int host_team_size = 1;
+  void (*host_team_sync)(void *) = nullptr;
+  void *host_team_barrier = nullptr;
+
+  //! team-shared memory of this team on the host
+  void *shared_mem_ptr = nullptr;
+  size_t shared_mem_offset = 0;
+
   LaunchContext(Resources const &base, ExecPlace place)
       : Resources(base), exec_place(place)
   {
@@ -170,8 +191,39 @@ public:
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#else
+    if (host_team_sync) {
+      host_team_sync(host_team_barrier);
+    }
+#endif
+  }
+
+  /*!
+   * Returns count objects of type T of team-shared memory, taken from the
+   * shared_mem_size bytes requested in Resources. Every thread of a team
+   * gets the same memory when it makes the same sequence of calls.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t count)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    extern __shared__ char raja_teams_shared_mem[];
+    char *base = raja_teams_shared_mem;
+#else
+    char *base = static_cast<char *>(shared_mem_ptr);
 #endif
+    shared_mem_offset =
+        (shared_mem_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+    T *ptr = reinterpret_cast<T *>(base + shared_mem_offset);
+    shared_mem_offset += count * sizeof(T);
+    return ptr;
   }
+
+  /*!
+   * Makes all of the team-shared memory available to getSharedMemory again.
+   */
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory() { shared_mem_offset = 0; }
 };
 
 
@@ -264,6 +316,93 @@ RAJA_HOST_DEVICE RAJA_INLINE void loop(CONTEXT const &ctx,
 #endif
 }
 
+template <typename POLICY, typename SEGMENT>
+struct LoopICountExecute;
+
+/*!
+ * Like loop, but body also gets the local index of each iterate, its
+ * position in the segment, to address team-shared tiles.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment, body);
+#endif
+}
+
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment0,
+                                              SEGMENT const &segment1,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, body);
+#endif
+}
+
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                              SEGMENT const &segment0,
+                                              SEGMENT const &segment1,
+                                              SEGMENT const &segment2,
+                                              BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  LoopICountExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, segment2, body);
+#else
+  LoopICountExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, segment0, segment1, segment2, body);
+#endif
+}
+
+template <typename POLICY, typename SEGMENT>
+struct TileExecute;
+
+/*!
+ * Splits segment into tiles of tile_size iterates, the last one possibly
+ * shorter, and calls body with each tile as a segment.
+ */
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename TILE_T,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void tile(CONTEXT const &ctx,
+                                       TILE_T tile_size,
+                                       SEGMENT const &segment,
+                                       BODY const &body)
+{
+#if defined(RAJA_DEVICE_CODE)
+  TileExecute<typename POLICY_LIST::device_policy_t, SEGMENT>::exec(
+      ctx, tile_size, segment, body);
+#else
+  TileExecute<typename POLICY_LIST::host_policy_t, SEGMENT>::exec(
+      ctx, tile_size, segment, body);
+#endif
+}
+
 }  // namespace expt
 
 }  // namespace RAJA
@@ -53,7 +53,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
     threads.x = ctx.threads.value[0];
     threads.y = ctx.threads.value[1];
     threads.z = ctx.threads.value[2];
-    launch_global_fcn<<<blocks, threads>>>(ctx, body);
+    launch_global_fcn<<<blocks, threads, ctx.shared_mem_size>>>(ctx, body);
 
     if (!async) {
       hipDeviceSynchronize();
@@ -85,7 +85,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
     threads.x = ctx.threads.value[0];
     threads.y = ctx.threads.value[1];
     threads.z = ctx.threads.value[2];
-    launch_global_fcn_fixed<nthreads><<<blocks, threads>>>(ctx, body);
+    launch_global_fcn_fixed<nthreads><<<blocks, threads, ctx.shared_mem_size>>>(ctx, body);
 
     if (!async) {
       hipDeviceSynchronize();
@@ -18,6 +18,16 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <omp.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -30,12 +40,181 @@ namespace expt
 struct omp_launch_t {
 };
 
+namespace detail
+{
+
+//! Alignment of team-shared memory on the host, one cache line
+constexpr size_t omp_team_shared_mem_align = 64;
+
+/*!
+ * Allocate nbytes of team-shared memory aligned to a cache line, or
+ * nothing if nbytes is zero.
+ */
+RAJA_INLINE std::unique_ptr<char, FreeAligned> omp_team_shared_mem_alloc(
+    size_t nbytes)
+{
+  std::unique_ptr<char, FreeAligned> mem;
+  if (nbytes > 0) {
+    mem.reset(RAJA::allocate_aligned_type<char>(omp_team_shared_mem_align,
+                                                nbytes));
+    if (!mem) {
+      RAJA_ABORT_OR_THROW("Teams shared memory allocation failed");
+    }
+  }
+  return mem;
+}
+
+}  // namespace detail
+
 template <>
 struct LaunchExecute<RAJA::expt::omp_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    std::unique_ptr<char, FreeAligned> shared_mem =
+        detail::omp_team_shared_mem_alloc(ctx.shared_mem_size);
+
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.get();
+    body(team_ctx);
+  }
+};
+
+
+/*!
+ * Launch policy that runs the launch body on every thread of one OpenMP
+ * parallel region, with the threads split into host teams of
+ * threads_per_team threads.
+ *
+ * Each host team has its own shared_mem_size bytes of team-shared memory,
+ * from LaunchContext::getSharedMemory, and teamSync() is a barrier of the
+ * threads of the team. The omp_team_loop and omp_team_thread_loop loop
+ * policies split iterations over the teams and over the threads of a team,
+ * so a kernel pays for one fork/join instead of one per loop.
+ *
+ * Variables declared RAJA_TEAM_SHARED are private to each host thread, so
+ * kernels with more than one thread per team use getSharedMemory instead.
+ */
+template <int threads_per_team = 1>
+struct omp_team_launch_t {
+  static_assert(threads_per_team > 0, "a team needs at least one thread");
+};
+
+namespace detail
+{
+
+/*!
+ * Barrier of the threads of one host team.
+ */
+class omp_team_barrier
+{
+public:
+  void init(int size)
+  {
+    m_size = size;
+    m_count.store(0, std::memory_order_relaxed);
+    m_generation.store(0, std::memory_order_relaxed);
+  }
+
+  void wait()
+  {
+    const unsigned generation = m_generation.load(std::memory_order_acquire);
+    if (m_count.fetch_add(1, std::memory_order_acq_rel) == m_size - 1) {
+      m_count.store(0, std::memory_order_relaxed);
+      m_generation.fetch_add(1, std::memory_order_release);
+    } else {
+      for (int spins = 0;
+           m_generation.load(std::memory_order_acquire) == generation;
+           ++spins) {
+        if (spins >= 1024) {
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+  static void sync(void *barrier)
+  {
+    static_cast<omp_team_barrier *>(barrier)->wait();
+  }
+
+private:
+  std::atomic<int> m_count{0};
+  std::atomic<unsigned> m_generation{0};
+  int m_size = 1;
+};
+
+/*!
+ * Contiguous part [begin, end) of [0, len) given to part of num_parts.
+ */
+template <typename IndexType>
+RAJA_INLINE void omp_team_partition(IndexType len,
+                                    int part,
+                                    int num_parts,
+                                    IndexType &begin,
+                                    IndexType &end)
+{
+  const IndexType chunk = len / num_parts;
+  const IndexType extra = len % num_parts;
+  begin = part * chunk + (part < extra ? part : extra);
+  end = begin + chunk + (part < extra ? 1 : 0);
+}
+
+}  // namespace detail
+
+template <int threads_per_team>
+struct LaunchExecute<RAJA::expt::omp_team_launch_t<threads_per_team>> {
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    // round the team-shared memory of each team up to cache lines
+    constexpr size_t align = detail::omp_team_shared_mem_align;
+    const size_t shared_mem_stride =
+        (ctx.shared_mem_size + align - 1) / align * align;
+
+    const int max_threads = omp_get_max_threads();
+    const int max_team_size =
+        threads_per_team < max_threads ? threads_per_team : max_threads;
+
+    std::unique_ptr<detail::omp_team_barrier[]> barriers;
+    std::unique_ptr<char, FreeAligned> shared_mem;
+    int team_size = 1;
+    int num_teams = 1;
+
+#pragma omp parallel num_threads(max_threads / max_team_size * max_team_size)
+    {
+      // the runtime may give fewer threads than requested
+#pragma omp single
+      {
+        const int num_threads = omp_get_num_threads();
+        team_size =
+            threads_per_team < num_threads ? threads_per_team : num_threads;
+        num_teams = num_threads / team_size;
+
+        barriers.reset(new detail::omp_team_barrier[num_teams]);
+        for (int t = 0; t < num_teams; ++t) {
+          barriers[t].init(team_size);
+        }
+        shared_mem =
+            detail::omp_team_shared_mem_alloc(shared_mem_stride * num_teams);
+      }
+
+      const int tid = omp_get_thread_num();
+      if (tid < num_teams * team_size) {
+        LaunchContext team_ctx(ctx);
+        team_ctx.host_team = tid / team_size;
+        team_ctx.host_num_teams = num_teams;
+        team_ctx.host_thread = tid % team_size;
+        team_ctx.host_team_size = team_size;
+        if (team_size > 1) {
+          team_ctx.host_team_sync = &detail::omp_team_barrier::sync;
+          team_ctx.host_team_barrier = &barriers[team_ctx.host_team];
+        }
+        team_ctx.shared_mem_ptr =
+            shared_mem.get() + shared_mem_stride * team_ctx.host_team;
+        body(team_ctx);
+      }
+    }
   }
 };
 
@@ -50,11 +229,12 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       BODY const &body)
   {
 
-    int len = segment.end() - segment.begin();
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
 #pragma omp parallel for
-    for (int i = 0; i < len; i++) {
+    for (decltype(len) i = 0; i < len; i++) {
 
-      body(*(segment.begin() + i));
+      body(begin[i]);
     }
   }
 
@@ -66,14 +246,16 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       BODY const &body)
   {
 
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
 #pragma omp parallel for RAJA_COLLAPSE(2)
-    for (int j = 0; j < len1; j++) {
-      for (int i = 0; i < len0; i++) {
+    for (decltype(len1) j = 0; j < len1; j++) {
+      for (decltype(len0) i = 0; i < len0; i++) {
 
-        body(*(segment0.begin() + i), *(segment1.begin() + j));
+        body(begin0[i], begin1[j]);
       }
     }
   }
@@ -87,23 +269,359 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       BODY const &body)
   {
 
-    const int len2 = segment2.end() - segment2.begin();
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
 #pragma omp parallel for RAJA_COLLAPSE(3)
-    for (int k = 0; k < len2; k++) {
-      for (int j = 0; j < len1; j++) {
-        for (int i = 0; i < len0; i++) {
-          body(*(segment0.begin() + i),
-               *(segment1.begin() + j),
-               *(segment2.begin() + k));
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i], begin1[j], begin2[k]);
         }
       }
     }
   }
 };
 
+// policies for the teams and the threads of a team of omp_team_launch_t
+struct omp_team_loop;
+struct omp_team_thread_loop;
+
+namespace detail
+{
+
+/*!
+ * Runs the part of the iteration space of one to three segments, flattened
+ * with segment0 fastest, given to part of num_parts.
+ */
+template <typename BODY, typename SEGMENT>
+RAJA_INLINE void omp_team_loop_part(int part,
+                                    int num_parts,
+                                    SEGMENT const &segment,
+                                    BODY const &body)
+{
+  auto begin = segment.begin();
+  using len_t = decltype(segment.end() - segment.begin());
+  len_t first, last;
+  omp_team_partition<len_t>(segment.end() - begin, part, num_parts, first, last);
+
+  for (len_t i = first; i < last; ++i) {
+    body(begin[i]);
+  }
+}
+
+template <typename BODY, typename SEGMENT>
+RAJA_INLINE void omp_team_loop_part(int part,
+                                    int num_parts,
+                                    SEGMENT const &segment0,
+                                    SEGMENT const &segment1,
+                                    BODY const &body)
+{
+  auto begin1 = segment1.begin();
+  auto begin0 = segment0.begin();
+  using len_t = decltype(segment0.end() - segment0.begin());
+  // the flattened count overflows narrow index types, e.g. int for 2048^3
+  const std::int64_t len0 = segment0.end() - begin0;
+  const std::int64_t len1 = segment1.end() - begin1;
+  std::int64_t first, last;
+  omp_team_partition<std::int64_t>(len0 * len1, part, num_parts, first, last);
+  if (first >= last) {
+    return;
+  }
+
+  std::int64_t i = first % len0;
+  std::int64_t j = first / len0;
+  for (std::int64_t n = first; n < last; ++n) {
+    body(begin0[static_cast<len_t>(i)], begin1[static_cast<len_t>(j)]);
+    if (++i == len0) {
+      i = 0;
+      ++j;
+    }
+  }
+}
+
+template <typename BODY, typename SEGMENT>
+RAJA_INLINE void omp_team_loop_part(int part,
+                                    int num_parts,
+                                    SEGMENT const &segment0,
+                                    SEGMENT const &segment1,
+                                    SEGMENT const &segment2,
+                                    BODY const &body)
+{
+  auto begin2 = segment2.begin();
+  auto begin1 = segment1.begin();
+  auto begin0 = segment0.begin();
+  using len_t = decltype(segment0.end() - segment0.begin());
+  const std::int64_t len0 = segment0.end() - begin0;
+  const std::int64_t len1 = segment1.end() - begin1;
+  const std::int64_t len2 = segment2.end() - begin2;
+  std::int64_t first, last;
+  omp_team_partition<std::int64_t>(
+      len0 * len1 * len2, part, num_parts, first, last);
+  if (first >= last) {
+    return;
+  }
+
+  std::int64_t i = first % len0;
+  std::int64_t j = (first / len0) % len1;
+  std::int64_t k = first / (len0 * len1);
+  for (std::int64_t n = first; n < last; ++n) {
+    body(begin0[static_cast<len_t>(i)],
+         begin1[static_cast<len_t>(j)],
+         begin2[static_cast<len_t>(k)]);
+    if (++i == len0) {
+      i = 0;
+      if (++j == len1) {
+        j = 0;
+        ++k;
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+ * Splits the iterations into contiguous parts, one per host team.
+ */
+template <typename SEGMENT>
+struct LoopExecute<omp_team_loop, SEGMENT> {
+
+  template <typename... SEGMENTS_AND_BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENTS_AND_BODY const &... args)
+  {
+    detail::omp_team_loop_part(ctx.host_team, ctx.host_num_teams, args...);
+  }
+};
+
+/*!
+ * Splits the iterations into contiguous parts, one per thread of the team.
+ */
+template <typename SEGMENT>
+struct LoopExecute<omp_team_thread_loop, SEGMENT> {
+
+  template <typename... SEGMENTS_AND_BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENTS_AND_BODY const &... args)
+  {
+    detail::omp_team_loop_part(ctx.host_thread, ctx.host_team_size, args...);
+  }
+};
+
+/*!
+ * loop_icount and tile over the host teams, or the threads of a team, of
+ * omp_team_launch_t; POLICY is omp_team_loop or omp_team_thread_loop.
+ */
+template <typename POLICY, typename SEGMENT>
+struct OmpTeamICountExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    auto begin = segment.begin();
+    using len_t = decltype(segment.end() - segment.begin());
+    LoopExecute<POLICY, TypedRangeSegment<len_t>>::exec(
+        ctx,
+        TypedRangeSegment<len_t>(0, segment.end() - segment.begin()),
+        [&](len_t i) { body(begin[i], i); });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    using len_t = decltype(segment0.end() - segment0.begin());
+    LoopExecute<POLICY, TypedRangeSegment<len_t>>::exec(
+        ctx,
+        TypedRangeSegment<len_t>(0, segment0.end() - segment0.begin()),
+        TypedRangeSegment<len_t>(0, segment1.end() - segment1.begin()),
+        [&](len_t i, len_t j) {
+          body(begin0[i], begin1[j], i, j);
+        });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    using len_t = decltype(segment0.end() - segment0.begin());
+    LoopExecute<POLICY, TypedRangeSegment<len_t>>::exec(
+        ctx,
+        TypedRangeSegment<len_t>(0, segment0.end() - segment0.begin()),
+        TypedRangeSegment<len_t>(0, segment1.end() - segment1.begin()),
+        TypedRangeSegment<len_t>(0, segment2.end() - segment2.begin()),
+        [&](len_t i, len_t j, len_t k) {
+          body(begin0[i],
+               begin1[j],
+               begin2[k],
+               i,
+               j,
+               k);
+        });
+  }
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void tile(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    using len_t = decltype(segment.end() - segment.begin());
+    const len_t len = segment.end() - segment.begin();
+    const len_t num_tiles = (len + tile_size - 1) / tile_size;
+    LoopExecute<POLICY, TypedRangeSegment<len_t>>::exec(
+        ctx, TypedRangeSegment<len_t>(0, num_tiles), [&](len_t t) {
+          body(segment.slice(t * tile_size, tile_size));
+        });
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_loop, SEGMENT>
+    : OmpTeamICountExecute<omp_team_loop, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_thread_loop, SEGMENT>
+    : OmpTeamICountExecute<omp_team_thread_loop, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_team_loop, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    OmpTeamICountExecute<omp_team_loop, SEGMENT>::tile(ctx,
+                                                       tile_size,
+                                                       segment,
+                                                       body);
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_team_thread_loop, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    OmpTeamICountExecute<omp_team_thread_loop, SEGMENT>::tile(ctx,
+                                                              tile_size,
+                                                              segment,
+                                                              body);
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_parallel_for_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
+#pragma omp parallel for
+    for (decltype(len) i = 0; i < len; i++) {
+      body(begin[i], i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+#pragma omp parallel for RAJA_COLLAPSE(2)
+    for (decltype(len1) j = 0; j < len1; j++) {
+      for (decltype(len0) i = 0; i < len0; i++) {
+        body(begin0[i], begin1[j], i, j);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+#pragma omp parallel for RAJA_COLLAPSE(3)
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i],
+               begin1[j],
+               begin2[k],
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_parallel_for_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    auto len = segment.end() - segment.begin();
+    auto num_tiles = (len + tile_size - 1) / tile_size;
+#pragma omp parallel for
+    for (decltype(num_tiles) t = 0; t < num_tiles; t++) {
+      body(segment.slice(t * tile_size, tile_size));
+    }
+  }
+};
+
 // policy for perfectly nested loops
 struct omp_parallel_nested_for_exec;
 
@@ -118,14 +636,16 @@ struct LoopExecute<omp_parallel_nested_for_exec, SEGMENT> {
       BODY const &body)
   {
 
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
 #pragma omp parallel for RAJA_COLLAPSE(2)
-    for (int j = 0; j < len1; j++) {
-      for (int i = 0; i < len0; i++) {
+    for (decltype(len1) j = 0; j < len1; j++) {
+      for (decltype(len0) i = 0; i < len0; i++) {
 
-        body(*(segment0.begin() + i), *(segment1.begin() + j));
+        body(begin0[i], begin1[j]);
       }
     }
   }
@@ -139,17 +659,18 @@ struct LoopExecute<omp_parallel_nested_for_exec, SEGMENT> {
       BODY const &body)
   {
 
-    const int len2 = segment2.end() - segment2.begin();
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
 #pragma omp parallel for RAJA_COLLAPSE(3)
-    for (int k = 0; k < len2; k++) {
-      for (int j = 0; j < len1; j++) {
-        for (int i = 0; i < len0; i++) {
-          body(*(segment0.begin() + i),
-               *(segment1.begin() + j),
-               *(segment2.begin() + k));
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i], begin1[j], begin2[k]);
         }
       }
     }
@@ -19,8 +19,12 @@
 #ifndef RAJA_pattern_teams_sequential_HPP
 #define RAJA_pattern_teams_sequential_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
 
 
 namespace RAJA
@@ -48,7 +52,13 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    std::vector<std::max_align_t> shared_mem(
+        (ctx.shared_mem_size + sizeof(std::max_align_t) - 1) /
+        sizeof(std::max_align_t));
+
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.data();
+    body(team_ctx);
   }
 };
 
@@ -62,11 +72,164 @@ struct LoopExecute<loop_exec, SEGMENT> {
       BODY const &body)
   {
 
-    // block stride loop
-    const int len = segment.end() - segment.begin();
-    for (int i = 0; i < len; i++) {
+    // index with the segment's own difference type, so long segments
+    // do not overflow, and read iterates through a hoisted iterator
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
+    for (decltype(len) i = 0; i < len; i++) {
+
+      body(begin[i]);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+    for (decltype(len1) j = 0; j < len1; j++) {
+      for (decltype(len0) i = 0; i < len0; i++) {
+
+        body(begin0[i], begin1[j]);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i], begin1[j], begin2[k]);
+        }
+      }
+    }
+  }
+};
+
+// inner loops are marked for vectorization
+template <typename SEGMENT>
+struct LoopExecute<simd_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
+    RAJA_SIMD
+    for (decltype(len) i = 0; i < len; i++) {
+
+      body(begin[i]);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+    for (decltype(len1) j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (decltype(len0) i = 0; i < len0; i++) {
+
+        body(begin0[i], begin1[j]);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i], begin1[j], begin2[k]);
+        }
+      }
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<loop_exec, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
+    for (decltype(len) i = 0; i < len; i++) {
+      body(begin[i], i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
-      body(*(segment.begin() + i));
+    for (decltype(len1) j = 0; j < len1; j++) {
+      for (decltype(len0) i = 0; i < len0; i++) {
+        body(begin0[i], begin1[j], i, j);
+      }
     }
   }
 
@@ -75,17 +238,64 @@ struct LoopExecute<loop_exec, SEGMENT> {
       LaunchContext const RAJA_UNUSED_ARG(&ctx),
       SEGMENT const &segment0,
       SEGMENT const &segment1,
+      SEGMENT const &segment2,
       BODY const &body)
   {
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
+
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i],
+               begin1[j],
+               begin2[k],
+               i,
+               j,
+               k);
+        }
+      }
+    }
+  }
+};
 
-    // block stride loop
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
+template <typename SEGMENT>
+struct LoopICountExecute<simd_exec, SEGMENT> {
 
-    for (int j = 0; j < len1; j++) {
-      for (int i = 0; i < len0; i++) {
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    auto begin = segment.begin();
+    auto len = segment.end() - begin;
+    RAJA_SIMD
+    for (decltype(len) i = 0; i < len; i++) {
+      body(begin[i], i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
-        body(*(segment0.begin() + i), *(segment1.begin() + j));
+    for (decltype(len1) j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (decltype(len0) i = 0; i < len0; i++) {
+        body(begin0[i], begin1[j], i, j);
       }
     }
   }
@@ -98,24 +308,51 @@ struct LoopExecute<loop_exec, SEGMENT> {
       SEGMENT const &segment2,
       BODY const &body)
   {
+    auto begin2 = segment2.begin();
+    auto begin1 = segment1.begin();
+    auto begin0 = segment0.begin();
+    auto len2 = segment2.end() - begin2;
+    auto len1 = segment1.end() - begin1;
+    auto len0 = segment0.end() - begin0;
 
-    // block stride loop
-    const int len2 = segment2.end() - segment2.begin();
-    const int len1 = segment1.end() - segment1.begin();
-    const int len0 = segment0.end() - segment0.begin();
-
-    for (int k = 0; k < len2; k++) {
-      for (int j = 0; j < len1; j++) {
-        for (int i = 0; i < len0; i++) {
-          body(*(segment0.begin() + i),
-               *(segment1.begin() + j),
-               *(segment2.begin() + k));
+    for (decltype(len2) k = 0; k < len2; k++) {
+      for (decltype(len1) j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (decltype(len0) i = 0; i < len0; i++) {
+          body(begin0[i],
+               begin1[j],
+               begin2[k],
+               i,
+               j,
+               k);
         }
       }
     }
   }
 };
 
+template <typename SEGMENT>
+struct TileExecute<loop_exec, SEGMENT> {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+    auto len = segment.end() - segment.begin();
+    for (decltype(len) tx = 0; tx < len; tx += tile_size) {
+      body(segment.slice(tx, tile_size));
+    }
+  }
+};
+
+// tiles of a simd loop run one after the other
+template <typename SEGMENT>
+struct TileExecute<simd_exec, SEGMENT> : TileExecute<loop_exec, SEGMENT> {
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
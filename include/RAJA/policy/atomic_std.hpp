@@ -0,0 +1,403 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations using std::atomic_ref
+ *          when available and compiler builtins otherwise.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_std_HPP
+#define RAJA_policy_atomic_std_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#include "RAJA/policy/atomic_builtin.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#if defined(__cpp_lib_atomic_ref) && (__cpp_lib_atomic_ref >= 201806L)
+#define RAJA_HAVE_STD_ATOMIC_REF
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Tell the processor this thread is spinning, which frees pipeline resources
+ * for a sibling hyperthread and saves power while waiting.
+ */
+RAJA_INLINE void cpu_relax()
+{
+#if defined(RAJA_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__powerpc__) || defined(__powerpc64__)
+  __asm__ __volatile__("or 27,27,27" ::: "memory");
+#endif
+}
+
+/*!
+ * Exponential backoff for compare and swap retry loops.
+ *
+ * Nothing is paid until a compare and swap fails, which only happens when
+ * another thread updated the same location. Each further failure doubles the
+ * wait, so threads hammering a hot location spread out instead of
+ * invalidating the cache line on every attempt.
+ */
+struct ExponentialBackoff {
+
+  static constexpr unsigned max_spins = 1024;
+
+  unsigned spins = 1;
+
+  RAJA_INLINE void operator()()
+  {
+    for (unsigned i = 0; i < spins; ++i) {
+      cpu_relax();
+    }
+    if (spins < max_spins) {
+      spins *= 2;
+    }
+  }
+};
+
+#if defined(RAJA_HAVE_STD_ATOMIC_REF)
+
+/*!
+ * Atomic access to a memory location through std::atomic_ref.
+ */
+template <typename T>
+struct StdAtomicRef {
+
+  std::atomic_ref<T> ref;
+
+  RAJA_INLINE explicit StdAtomicRef(T volatile *acc)
+      : ref(*const_cast<T *>(acc))
+  {
+  }
+
+  RAJA_INLINE T load() const { return ref.load(std::memory_order_relaxed); }
+
+  RAJA_INLINE bool compare_exchange_weak(T &expected, T desired)
+  {
+    return ref.compare_exchange_weak(expected,
+                                     desired,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed);
+  }
+
+  RAJA_INLINE T compare_exchange_strong(T expected, T desired)
+  {
+    ref.compare_exchange_strong(expected,
+                                desired,
+                                std::memory_order_acq_rel,
+                                std::memory_order_relaxed);
+    return expected;
+  }
+
+  RAJA_INLINE T exchange(T value)
+  {
+    return ref.exchange(value, std::memory_order_acq_rel);
+  }
+
+  RAJA_INLINE T fetch_add(T value)
+  {
+    return ref.fetch_add(value, std::memory_order_acq_rel);
+  }
+
+  RAJA_INLINE T fetch_sub(T value)
+  {
+    return ref.fetch_sub(value, std::memory_order_acq_rel);
+  }
+
+  RAJA_INLINE T fetch_and(T value)
+  {
+    return ref.fetch_and(value, std::memory_order_acq_rel);
+  }
+
+  RAJA_INLINE T fetch_or(T value)
+  {
+    return ref.fetch_or(value, std::memory_order_acq_rel);
+  }
+
+  RAJA_INLINE T fetch_xor(T value)
+  {
+    return ref.fetch_xor(value, std::memory_order_acq_rel);
+  }
+};
+
+#elif !defined(RAJA_COMPILER_MSVC)
+
+/*!
+ * Atomic access to a memory location through the compiler __atomic builtins,
+ * which have the same semantics as std::atomic_ref.
+ */
+template <typename T>
+struct StdAtomicRef {
+
+  T volatile *ptr;
+
+  RAJA_INLINE explicit StdAtomicRef(T volatile *acc) : ptr(acc) {}
+
+  RAJA_INLINE T load() const
+  {
+    T ret;
+    __atomic_load(const_cast<T *>(ptr), &ret, __ATOMIC_RELAXED);
+    return ret;
+  }
+
+  RAJA_INLINE bool compare_exchange_weak(T &expected, T desired)
+  {
+    return __atomic_compare_exchange(const_cast<T *>(ptr),
+                                     &expected,
+                                     &desired,
+                                     true,
+                                     __ATOMIC_ACQ_REL,
+                                     __ATOMIC_RELAXED);
+  }
+
+  RAJA_INLINE T compare_exchange_strong(T expected, T desired)
+  {
+    __atomic_compare_exchange(const_cast<T *>(ptr),
+                              &expected,
+                              &desired,
+                              false,
+                              __ATOMIC_ACQ_REL,
+                              __ATOMIC_RELAXED);
+    return expected;
+  }
+
+  RAJA_INLINE T exchange(T value)
+  {
+    T ret;
+    __atomic_exchange(const_cast<T *>(ptr), &value, &ret, __ATOMIC_ACQ_REL);
+    return ret;
+  }
+
+  RAJA_INLINE T fetch_add(T value)
+  {
+    return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+  }
+
+  RAJA_INLINE T fetch_sub(T value)
+  {
+    return __atomic_fetch_sub(ptr, value, __ATOMIC_ACQ_REL);
+  }
+
+  RAJA_INLINE T fetch_and(T value)
+  {
+    return __atomic_fetch_and(ptr, value, __ATOMIC_ACQ_REL);
+  }
+
+  RAJA_INLINE T fetch_or(T value)
+  {
+    return __atomic_fetch_or(ptr, value, __ATOMIC_ACQ_REL);
+  }
+
+  RAJA_INLINE T fetch_xor(T value)
+  {
+    return __atomic_fetch_xor(ptr, value, __ATOMIC_ACQ_REL);
+  }
+};
+
+#endif
+
+#if defined(RAJA_HAVE_STD_ATOMIC_REF) || !defined(RAJA_COMPILER_MSVC)
+
+/*!
+ * Generic implementation of any atomic operator using a weak compare and
+ * swap loop with exponential backoff.
+ * The loop stops without writing when sc returns true for the current value.
+ * Returns the OLD value that was replaced by the result of this operation.
+ */
+template <typename T, typename OPER, typename ShortCircuit>
+RAJA_INLINE T std_atomic_CAS_oper_sc(T volatile *acc,
+                                     OPER const &oper,
+                                     ShortCircuit const &sc)
+{
+  StdAtomicRef<T> ref(acc);
+  ExponentialBackoff backoff;
+
+  T oldval = ref.load();
+  while (!sc(oldval)) {
+    if (ref.compare_exchange_weak(oldval, oper(oldval))) {
+      break;
+    }
+    backoff();
+  }
+  return oldval;
+}
+
+template <typename T, typename OPER>
+RAJA_INLINE T std_atomic_CAS_oper(T volatile *acc, OPER const &oper)
+{
+  return std_atomic_CAS_oper_sc(acc, oper, [](T const &) { return false; });
+}
+
+#endif
+
+}  // namespace detail
+
+
+#if defined(RAJA_HAVE_STD_ATOMIC_REF) || !defined(RAJA_COMPILER_MSVC)
+
+/*!
+ * Atomic policy that uses std::atomic_ref, or equivalent compiler builtins
+ * before C++20.
+ *
+ * Integral add, subtract, bitwise and exchange operations use the hardware
+ * read-modify-write instructions. Everything else, including floating point
+ * add and min/max, uses a weak compare and swap loop with exponential
+ * backoff, and min/max return without writing when the stored value already
+ * wins.
+ */
+struct std_atomic {
+};
+
+
+template <typename T>
+RAJA_INLINE typename std::enable_if<std::is_integral<T>::value, T>::type
+atomicAdd(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).fetch_add(value);
+}
+
+template <typename T>
+RAJA_INLINE typename std::enable_if<!std::is_integral<T>::value, T>::type
+atomicAdd(std_atomic, T volatile *acc, T value)
+{
+  return detail::std_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+}
+
+
+template <typename T>
+RAJA_INLINE typename std::enable_if<std::is_integral<T>::value, T>::type
+atomicSub(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).fetch_sub(value);
+}
+
+template <typename T>
+RAJA_INLINE typename std::enable_if<!std::is_integral<T>::value, T>::type
+atomicSub(std_atomic, T volatile *acc, T value)
+{
+  return detail::std_atomic_CAS_oper(acc, [=](T a) { return a - value; });
+}
+
+template <typename T>
+RAJA_INLINE T atomicMin(std_atomic, T volatile *acc, T value)
+{
+  return detail::std_atomic_CAS_oper_sc(acc,
+                                        [=](T a) {
+                                          return a < value ? a : value;
+                                        },
+                                        [=](T current) {
+                                          return !(value < current);
+                                        });
+}
+
+template <typename T>
+RAJA_INLINE T atomicMax(std_atomic, T volatile *acc, T value)
+{
+  return detail::std_atomic_CAS_oper_sc(acc,
+                                        [=](T a) {
+                                          return a > value ? a : value;
+                                        },
+                                        [=](T current) {
+                                          return !(value > current);
+                                        });
+}
+
+template <typename T>
+RAJA_INLINE T atomicInc(std_atomic, T volatile *acc)
+{
+  return RAJA::atomicAdd(std_atomic{}, acc, static_cast<T>(1));
+}
+
+template <typename T>
+RAJA_INLINE T atomicInc(std_atomic, T volatile *acc, T val)
+{
+  return detail::std_atomic_CAS_oper(acc, [=](T old) {
+    return ((old >= val) ? 0 : (old + 1));
+  });
+}
+
+template <typename T>
+RAJA_INLINE T atomicDec(std_atomic, T volatile *acc)
+{
+  return RAJA::atomicSub(std_atomic{}, acc, static_cast<T>(1));
+}
+
+template <typename T>
+RAJA_INLINE T atomicDec(std_atomic, T volatile *acc, T val)
+{
+  return detail::std_atomic_CAS_oper(acc, [=](T old) {
+    return (((old == 0) | (old > val)) ? val : (old - 1));
+  });
+}
+
+template <typename T>
+RAJA_INLINE T atomicAnd(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).fetch_and(value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicOr(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).fetch_or(value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicXor(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).fetch_xor(value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicExchange(std_atomic, T volatile *acc, T value)
+{
+  return detail::StdAtomicRef<T>(acc).exchange(value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicCAS(std_atomic, T volatile *acc, T compare, T value)
+{
+  return detail::StdAtomicRef<T>(acc).compare_exchange_strong(compare, value);
+}
+
+#else  // MSVC without std::atomic_ref
+
+
+// For MS Visual C without std::atomic_ref, just default to builtin_atomic
+using std_atomic = builtin_atomic;
+
+
+#endif
+
+}  // namespace RAJA
+
+#endif
@@ -22,6 +22,8 @@
 
 #include "RAJA/policy/loop/atomic.hpp"
 #include "RAJA/policy/loop/forall.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
+#include "RAJA/policy/loop/segmented.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
@@ -0,0 +1,64 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter_add and histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_loop_HPP
+#define RAJA_histogram_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief add values into the bins given by indices,
+               there is no contention so every strategy adds directly
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+scatter_add(const ExecPolicy&,
+            IdxIter idx,
+            DiffType n,
+            ValFn val,
+            OutIter out,
+            DiffType,
+            ScatterStrategy)
+{
+  RAJA::detail::histogram::scatter_range(idx, val, out, DiffType(0), n);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,159 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce and scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_loop_HPP
+#define RAJA_segmented_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/pattern/detail/segmented.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace segmented
+{
+
+/*!
+        \brief reduce each segment [offsets[s], offsets[s+1]) of vals into
+               out[s], empty segments are set to identity
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+reduce(const ExecPolicy&,
+       Iter vals,
+       OffIter offsets,
+       DiffType num_segments,
+       OutIter out,
+       BinFn f,
+       T identity)
+{
+  for (DiffType s = 0; s < num_segments; ++s) {
+    const DiffType e = offsets[s + 1];
+    T agg = identity;
+    for (DiffType i = offsets[s]; i < e; ++i) {
+      agg = f(agg, vals[i]);
+    }
+    out[s] = agg;
+  }
+}
+
+/*!
+        \brief inclusive scan of n values that restarts at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+inclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f)
+{
+  using Value = RAJA::detail::IterVal<OutIter>;
+  bool has_head;
+  Value tail;
+  RAJA::detail::segmented::inclusive_chunk(
+      in, heads, out, f, DiffType(0), n, has_head, tail);
+}
+
+/*!
+        \brief exclusive scan of n values that restarts from v at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+exclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f,
+          T v)
+{
+  bool has_head;
+  T tail;
+  RAJA::detail::segmented::exclusive_chunk(
+      in, heads, out, f, v, DiffType(0), n, has_head, tail);
+}
+
+/*!
+        \brief write the key and reduced value of each run of equal keys,
+               returns the number of runs
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValFn,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if_t<DiffType, type_traits::is_loop_policy<ExecPolicy>>
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys,
+              DiffType n,
+              ValFn vals,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using Value = RAJA::detail::IterVal<ValOutIter>;
+  const RAJA::detail::segmented::KeyHeads<KeyIter> heads{keys};
+
+  DiffType pos = 0;
+  DiffType i = 0;
+  while (i < n) {
+    keys_out[pos] = keys[i];
+    Value agg = vals(i);
+    for (++i; i < n && !heads(i); ++i) {
+      agg = f(agg, vals(i));
+    }
+    vals_out[pos] = agg;
+    ++pos;
+  }
+  return pos;
+}
+
+}  // namespace segmented
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -21,13 +21,20 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/util/zip.hpp"
 
 #include "RAJA/util/sort.hpp"
@@ -56,6 +63,14 @@ struct UnstableSorter
   {
     RAJA::intro_sort(std::forward<Args>(args)...);
   }
+
+  // intro_sort needs no scratch memory, so the allocator is not used
+  template < typename Iter, typename Compare, typename Allocator >
+  RAJA_INLINE
+  void operator()(Iter begin, Iter end, Compare comp, Allocator const&) const
+  {
+    RAJA::intro_sort(begin, end, comp);
+  }
 };
 
 /*!
@@ -72,6 +87,425 @@ struct StableSorter
   }
 };
 
+/*!
+    \brief Functional that runs body(i) for i in [0, n) in order
+*/
+struct LoopFor
+{
+  template < typename DiffType, typename Body >
+  RAJA_INLINE
+  void operator()(DiffType n, Body const& body) const
+  {
+    for (DiffType i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+
+  RAJA_INLINE
+  int num_chunks() const
+  {
+    return 1;
+  }
+};
+
+/*!
+    \brief reorder vals so that vals[i] becomes vals[perm[i]], by moving
+           through a buffer with two passes of for_all
+*/
+template < typename For, typename PermIndex, typename DiffType, typename ValIter >
+inline
+void apply_permutation(For for_all,
+                       PermIndex const* perm,
+                       DiffType n,
+                       ValIter vals)
+{
+  using value_type = RAJA::detail::IterVal<ValIter>;
+
+  // Manage the lifetime of the buffer and objects constructed in the buffer
+  RAJA::detail::SortScratch<value_type, RAJA::detail::SortScratchAllocator<char>>
+      scratch(RAJA::detail::SortScratchAllocator<char>{}, n);
+
+  value_type* copyarr = scratch.data;
+
+  for_all(n, [=](DiffType i) {
+    new(&copyarr[i]) value_type(std::move(vals[perm[i]]));
+  });
+  scratch.constructed = n;
+
+  for_all(n, [=](DiffType i) {
+    vals[i] = std::move(copyarr[i]);
+  });
+}
+
+/*!
+    \brief sort keys together with a permutation of PermIndex using sorter
+           then reorder each range of values with the permutation, so each
+           swap in the sort moves a key and an index instead of every value
+*/
+template < typename PermIndex, typename Sorter, typename For,
+           typename KeyIter, typename Compare, typename... ValIters >
+inline
+void sort_by_key_permutation(Sorter sorter,
+                             For for_all,
+                             KeyIter keys_begin,
+                             KeyIter keys_end,
+                             Compare comp,
+                             ValIters... vals_begins)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+
+  const diff_type n = keys_end - keys_begin;
+
+  RAJA::detail::SortScratch<PermIndex, RAJA::detail::SortScratchAllocator<char>>
+      perm(RAJA::detail::SortScratchAllocator<char>{}, n);
+
+  PermIndex* permarr = perm.data;
+
+  for_all(n, [=](diff_type i) {
+    permarr[i] = static_cast<PermIndex>(i);
+  });
+
+  auto begin = RAJA::zip(keys_begin, permarr);
+  auto end = RAJA::zip(keys_end, permarr+n);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  camp::sink((apply_permutation(for_all, static_cast<PermIndex const*>(permarr), n, vals_begins), 0)...);
+}
+
+/*!
+    \brief sort keys and reorder any number of ranges of values with them,
+           through a 32 bit permutation when the range is small enough
+*/
+template < typename Sorter, typename For,
+           typename KeyIter, typename Compare, typename... ValIters >
+inline
+void sort_by_key(Sorter sorter,
+                 For for_all,
+                 KeyIter keys_begin,
+                 KeyIter keys_end,
+                 Compare comp,
+                 ValIters... vals_begins)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+
+  const diff_type n = keys_end - keys_begin;
+
+  if (n < 2) {
+    return;
+  }
+
+  if (static_cast<unsigned long long>(n) <= std::numeric_limits<std::uint32_t>::max()) {
+    sort_by_key_permutation<std::uint32_t>(sorter, for_all, keys_begin, keys_end, comp, vals_begins...);
+  } else {
+    sort_by_key_permutation<std::uint64_t>(sorter, for_all, keys_begin, keys_end, comp, vals_begins...);
+  }
+}
+
+/*!
+    \brief get the first index of chunk c of num_chunks nearly equal chunks
+           of a range of length n
+*/
+template < typename DiffType >
+RAJA_INLINE
+DiffType chunk_begin(DiffType n, DiffType num_chunks, DiffType c)
+{
+  return (n / num_chunks) * c + std::min(c, n % num_chunks);
+}
+
+/*!
+    \brief select nth so it holds the item it would hold if the range were
+           sorted, with no greater items before it and no less items after it
+
+    Large ranges are narrowed with rounds of a three way partition around a
+    pivot, each round counts and scatters chunks of the range in parallel
+    through a buffer with for_all, the rest is finished with intro select.
+*/
+template < typename For, typename Iter, typename Compare >
+inline
+void select_nth(For for_all,
+                Iter begin,
+                Iter nth,
+                Iter end,
+                Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  // ranges smaller than this are not worth partitioning in parallel
+  constexpr diff_type parallel_cutoff = 1 << 14;
+
+  const diff_type n = end - begin;
+  const diff_type num_chunks = for_all.num_chunks();
+
+  if (nth == end) {
+    return;
+  }
+
+  if (num_chunks > 1 && n > parallel_cutoff) {
+
+    using scratch_allocator = RAJA::detail::SortScratchAllocator<char>;
+
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    RAJA::detail::SortScratch<value_type, scratch_allocator>
+        scratch(scratch_allocator{}, n);
+
+    value_type* copyarr = scratch.data;
+
+    // per chunk counts of items less than and equivalent to the pivot
+    RAJA::detail::SortScratch<diff_type, scratch_allocator>
+        counts(scratch_allocator{}, 2*num_chunks);
+    diff_type* lt_counts = counts.data;
+    diff_type* eq_counts = counts.data + num_chunks;
+
+    const Iter range_begin = begin;
+    bool constructed = false;
+
+    for (unsigned depth = 2*RAJA::detail::ulog2(n);
+         end - begin > parallel_cutoff && depth > 0;
+         --depth) {
+
+      const diff_type len = end - begin;
+      value_type* buf = copyarr + (begin - range_begin);
+
+      // choose pivot with median of 3
+      Iter mid = begin + len/2;
+      Iter last = end-1;
+      const value_type pivot = comp(*begin, *mid)
+                      ? ( comp(*mid, *last)
+                             ? *mid
+                             : ( comp(*begin, *last)
+                                    ? *last
+                                    : *begin ) )
+                      : ( comp(*mid, *last)
+                             ? ( comp(*begin, *last)
+                                    ? *begin
+                                    : *last )
+                             : *mid );
+
+      for_all(num_chunks, [&](diff_type c) {
+        const diff_type first = chunk_begin(len, num_chunks, c);
+        const diff_type next = chunk_begin(len, num_chunks, c+1);
+        diff_type lt = 0;
+        diff_type eq = 0;
+        for (diff_type i = first; i < next; ++i) {
+          if (comp(begin[i], pivot)) {
+            ++lt;
+          } else if (!comp(pivot, begin[i])) {
+            ++eq;
+          }
+        }
+        lt_counts[c] = lt;
+        eq_counts[c] = eq;
+      });
+
+      // find where each chunk scatters each part of its items
+      diff_type num_lt = 0;
+      diff_type num_eq = 0;
+      for (diff_type c = 0; c < num_chunks; ++c) {
+        const diff_type lt = lt_counts[c];
+        const diff_type eq = eq_counts[c];
+        lt_counts[c] = num_lt;
+        eq_counts[c] = num_eq;
+        num_lt += lt;
+        num_eq += eq;
+      }
+
+      for_all(num_chunks, [&](diff_type c) {
+        const diff_type first = chunk_begin(len, num_chunks, c);
+        const diff_type next = chunk_begin(len, num_chunks, c+1);
+        diff_type lt_pos = lt_counts[c];
+        diff_type eq_pos = num_lt + eq_counts[c];
+        diff_type gt_pos = num_lt + num_eq + (first - lt_counts[c] - eq_counts[c]);
+        for (diff_type i = first; i < next; ++i) {
+          diff_type& pos = comp(begin[i], pivot)   ? lt_pos
+                         : !comp(pivot, begin[i])  ? eq_pos
+                                                   : gt_pos;
+          if (constructed) {
+            buf[pos] = std::move(begin[i]);
+          } else {
+            new(&buf[pos]) value_type(std::move(begin[i]));
+          }
+          ++pos;
+        }
+      });
+      if (!constructed) {
+        // the first round scatters the whole range
+        scratch.constructed = n;
+        constructed = true;
+      }
+
+      for_all(num_chunks, [&](diff_type c) {
+        const diff_type first = chunk_begin(len, num_chunks, c);
+        const diff_type next = chunk_begin(len, num_chunks, c+1);
+        for (diff_type i = first; i < next; ++i) {
+          begin[i] = std::move(buf[i]);
+        }
+      });
+
+      // continue in the part holding nth
+      const diff_type k = nth - begin;
+      if (k < num_lt) {
+        end = begin + num_lt;
+      } else if (k < num_lt + num_eq) {
+        return;
+      } else {
+        begin += num_lt + num_eq;
+      }
+    }
+  }
+
+  RAJA::detail::intro_select(begin, nth, end, comp,
+                             2*RAJA::detail::ulog2(end - begin));
+}
+
+/*!
+    \brief sort the smallest items of the range into [begin, middle) by
+           selecting the last of them then sorting only them with sorter
+*/
+template < typename Sorter, typename For, typename Iter, typename Compare >
+inline
+void sort_partial(Sorter sorter,
+                  For for_all,
+                  Iter begin,
+                  Iter middle,
+                  Iter end,
+                  Compare comp)
+{
+  if (begin == middle) {
+    return;
+  }
+
+  Iter last = RAJA::prev(middle);
+  select_nth(for_all, begin, last, end, comp);
+  sorter(begin, last, comp);
+}
+
+/*!
+    \brief copy the k smallest items of the range into out in sorted order
+
+    When k is small each chunk keeps its k smallest items in a heap and the
+    heaps are merged, otherwise a copy of the range is partially sorted.
+*/
+template < typename Sorter, typename For,
+           typename Iter, typename OutIter, typename Compare >
+inline
+void top_k(Sorter sorter,
+           For for_all,
+           Iter begin,
+           Iter end,
+           RAJA::detail::IterDiff<Iter> k,
+           OutIter out,
+           Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  const diff_type n = end - begin;
+  const diff_type num_chunks = for_all.num_chunks();
+
+  k = std::min(k, n);
+  if (k <= 0) {
+    return;
+  }
+
+  if (k <= n / (4*num_chunks)) {
+
+    std::vector<value_type> heaps(num_chunks*k, *begin);
+    RAJA::detail::SortScratch<diff_type, RAJA::detail::SortScratchAllocator<char>>
+        counts(RAJA::detail::SortScratchAllocator<char>{}, num_chunks);
+    diff_type* heap_counts = counts.data;
+
+    for_all(num_chunks, [&](diff_type c) {
+      auto heap = heaps.begin() + c*k;
+      heap_counts[c] = RAJA::detail::heap_select_copy(
+          begin + chunk_begin(n, num_chunks, c),
+          begin + chunk_begin(n, num_chunks, c+1),
+          heap, heap + k, comp) - heap;
+    });
+
+    // gather the candidates of all chunks to the front
+    diff_type num_candidates = heap_counts[0];
+    for (diff_type c = 1; c < num_chunks; ++c) {
+      auto heap = heaps.begin() + c*k;
+      num_candidates = std::move(heap, heap + heap_counts[c],
+                                 heaps.begin() + num_candidates) - heaps.begin();
+    }
+
+    RAJA::detail::heap_select_copy(heaps.begin(), heaps.begin() + num_candidates,
+                                   out, out + k, comp);
+
+  } else {
+
+    std::vector<value_type> copy(begin, end);
+
+    sort_partial(sorter, for_all, copy.begin(), copy.begin() + k, copy.end(), comp);
+
+    std::move(copy.begin(), copy.begin() + k, out);
+  }
+}
+
+/*!
+    \brief sort each segment [begin + offsets[s], begin + offsets[s+1]) of
+           the range independently
+
+    Segments are sorted in parallel with for_all, each one serially with a
+    sorting network, insertion or shell sort when small and intro sort
+    otherwise, then
+    segments too large to sort serially are sorted one at a time with sorter.
+*/
+template < typename Sorter, typename For,
+           typename Iter, typename OffsetIter, typename Compare >
+inline
+void segmented_sort(Sorter sorter,
+                    For for_all,
+                    Iter begin,
+                    OffsetIter offsets_begin,
+                    OffsetIter offsets_end,
+                    Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<OffsetIter>;
+
+  // segments up to this size are sorted with small_sort or shell sort
+  constexpr diff_type small_cutoff = 64;
+  // segments larger than this are sorted with sorter
+  constexpr diff_type large_cutoff = 1 << 14;
+
+  const diff_type num_segments = (offsets_end - offsets_begin) - 1;
+
+  if (num_segments <= 0) {
+    return;
+  }
+
+  std::atomic<bool> has_large(false);
+
+  for_all(num_segments, [&](diff_type s) {
+    Iter first = begin + offsets_begin[s];
+    Iter last = begin + offsets_begin[s+1];
+    const auto len = last - first;
+    if (len < static_cast<decltype(len)>(RAJA::detail::intro_sort_insertion_sort_cutoff::get())) {
+      RAJA::detail::small_sort(first, last, comp);
+    } else if (len <= small_cutoff) {
+      RAJA::detail::shell_sort(first, last, comp);
+    } else if (len <= large_cutoff) {
+      RAJA::detail::intro_sort(first, last, comp,
+                               2*RAJA::detail::ulog2(len));
+    } else {
+      has_large.store(true, std::memory_order_relaxed);
+    }
+  });
+
+  if (has_large.load(std::memory_order_relaxed)) {
+    for (diff_type s = 0; s < num_segments; ++s) {
+      Iter first = begin + offsets_begin[s];
+      Iter last = begin + offsets_begin[s+1];
+      if (last - first > large_cutoff) {
+        sorter(first, last, comp);
+      }
+    }
+  }
+}
+
 } // namespace detail
 
 /*!
@@ -134,6 +568,151 @@ stable_pairs(const ExecPolicy&,
   detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
 }
 
+/*!
+        \brief sort keys using comparison function and reorder each range
+               of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+unstable_by_key(const ExecPolicy&,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                Compare comp,
+                ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::UnstableSorter{}, detail::LoopFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief stable sort keys using comparison function and reorder each
+               range of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+stable_by_key(const ExecPolicy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              Compare comp,
+              ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::StableSorter{}, detail::LoopFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief partially sort given range using comparison function so
+               [begin, middle) holds its smallest items in sorted order
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+partial(const ExecPolicy&,
+        Iter begin,
+        Iter middle,
+        Iter end,
+        Compare comp)
+{
+  detail::sort_partial(detail::UnstableSorter{}, detail::LoopFor{},
+                       begin, middle, end, comp);
+}
+
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+nth_element(const ExecPolicy&,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp)
+{
+  detail::select_nth(detail::LoopFor{}, begin, nth, end, comp);
+}
+
+/*!
+        \brief copy k smallest items of given range in sorted order to out
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Compare>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+top_k(const ExecPolicy&,
+      Iter begin,
+      Iter end,
+      RAJA::detail::IterDiff<Iter> k,
+      OutIter out,
+      Compare comp)
+{
+  detail::top_k(detail::UnstableSorter{}, detail::LoopFor{},
+                begin, end, k, out, comp);
+}
+
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+unstable_segmented(const ExecPolicy&,
+                   Iter begin,
+                   OffsetIter offsets_begin,
+                   OffsetIter offsets_end,
+                   Compare comp)
+{
+  detail::segmented_sort(detail::UnstableSorter{}, detail::LoopFor{},
+                         begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+unstable_segmented_pairs(const ExecPolicy&,
+                         KeyIter keys_begin,
+                         ValIter vals_begin,
+                         OffsetIter offsets_begin,
+                         OffsetIter offsets_end,
+                         Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::segmented_sort(detail::UnstableSorter{}, detail::LoopFor{},
+                         begin, offsets_begin, offsets_end,
+                         RAJA::compare_first<zip_ref>(comp));
+}
+
+/*!
+        \brief sort given range using comparison function, ignoring the
+               scratch memory allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+unstable(const ExecPolicy& p,
+         Iter begin,
+         Iter end,
+         Compare comp,
+         Allocator const&)
+{
+  RAJA::impl::sort::unstable(p, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function, merging
+               through scratch memory allocated with scratch_allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+stable(const ExecPolicy&,
+       Iter begin,
+       Iter end,
+       Compare comp,
+       Allocator const& scratch_allocator)
+{
+  detail::StableSorter{}(begin, end, comp, scratch_allocator);
+}
+
 }  // namespace sort
 
 }  // namespace impl
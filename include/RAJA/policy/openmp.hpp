@@ -31,6 +31,8 @@
 
 #include "RAJA/policy/openmp/atomic.hpp"
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/histogram.hpp"
+#include "RAJA/policy/openmp/segmented.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
@@ -22,8 +22,9 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
-// rely on builtin_atomic when OpenMP can't do the job
+// rely on builtin_atomic and std_atomic when OpenMP can't do the job
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_std.hpp"
 
 #include "RAJA/util/macros.hpp"
 
@@ -80,8 +81,9 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicMin(omp_atomic, T volatile *acc, T value)
 {
-  // OpenMP doesn't define atomic trinary operators so use builtin atomics
-  return atomicMin(builtin_atomic{}, acc, value);
+  // OpenMP doesn't define atomic trinary operators so use std atomics,
+  // which return early when *acc already wins and back off under contention
+  return atomicMin(std_atomic{}, acc, value);
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -89,8 +91,9 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicMax(omp_atomic, T volatile *acc, T value)
 {
-  // OpenMP doesn't define atomic trinary operators so use builtin atomics
-  return atomicMax(builtin_atomic{}, acc, value);
+  // OpenMP doesn't define atomic trinary operators so use std atomics,
+  // which return early when *acc already wins and back off under contention
+  return atomicMax(std_atomic{}, acc, value);
 }
 
 
@@ -114,8 +117,8 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicInc(omp_atomic, T volatile *acc, T val)
 {
-  // OpenMP doesn't define atomic trinary operators so use builtin atomics
-  return RAJA::atomicInc(builtin_atomic{}, acc, val);
+  // OpenMP doesn't define atomic trinary operators so use std atomics
+  return RAJA::atomicInc(std_atomic{}, acc, val);
 }
 
 
@@ -139,8 +142,8 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicDec(omp_atomic, T volatile *acc, T val)
 {
-  // OpenMP doesn't define atomic trinary operators so use builtin atomics
-  return RAJA::atomicDec(builtin_atomic{}, acc, val);
+  // OpenMP doesn't define atomic trinary operators so use std atomics
+  return RAJA::atomicDec(std_atomic{}, acc, val);
 }
 
 RAJA_SUPPRESS_HD_WARN
@@ -204,8 +207,8 @@ template <typename T>
 RAJA_HOST_DEVICE
 RAJA_INLINE T atomicCAS(omp_atomic, T volatile *acc, T compare, T value)
 {
-  // OpenMP doesn't define atomic trinary operators so use builtin atomics
-  return RAJA::atomicCAS(builtin_atomic{}, acc, compare, value);
+  // OpenMP doesn't define atomic trinary operators so use std atomics
+  return RAJA::atomicCAS(std_atomic{}, acc, compare, value);
 }
 
 #endif  // not defined RAJA_COMPILER_MSVC
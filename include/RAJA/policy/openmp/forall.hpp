@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
@@ -40,6 +41,9 @@
 
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/util/Span.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
@@ -216,6 +220,212 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host&
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+//! The indices [begin, end) of one segment of an index set
+struct FusedSegmentChunk {
+  //! segment type id and offset, see TypedIndexSet::getSegmentByTypeId
+  Index_type type_id;
+  Index_type offset;
+  Index_type begin;
+  Index_type end;
+  //! icount of the index at begin
+  Index_type icount;
+};
+
+// these numbers are arbitrary
+constexpr Index_type get_fused_segit_min_chunk() { return 1024; }
+constexpr Index_type get_fused_segit_chunks_per_thread() { return 4; }
+
+/*!
+ * Flatten the segments of iset into a work list. Segments longer than the
+ * chunk size are split into chunks of nearly equal length, shorter ones
+ * are a single chunk.
+ */
+template <typename... SegmentTypes>
+RAJA_INLINE std::vector<FusedSegmentChunk> make_fused_segment_chunks(
+    const TypedIndexSet<SegmentTypes...>& iset)
+{
+  const Index_type num_seg = iset.getNumSegments();
+  const Index_type len = iset.getLength();
+  const Index_type num_chunks =
+      omp_get_max_threads() * get_fused_segit_chunks_per_thread();
+
+  Index_type chunk_size = (len + num_chunks - 1) / num_chunks;
+  if (chunk_size < get_fused_segit_min_chunk()) {
+    chunk_size = get_fused_segit_min_chunk();
+  }
+
+  std::vector<FusedSegmentChunk> chunks;
+  chunks.reserve(num_seg + len / chunk_size);
+
+  for (Index_type segid = 0; segid < num_seg; ++segid) {
+    const Index_type icount = iset.getStartingIcount(segid);
+    const Index_type seg_len =
+        (segid + 1 < num_seg ? iset.getStartingIcount(segid + 1) : len) -
+        icount;
+    if (seg_len <= 0) {
+      continue;
+    }
+    const Index_type type_id = iset.getSegmentTypeId(segid);
+    const Index_type offset = iset.getSegmentOffset(segid);
+    const Index_type seg_chunks = (seg_len + chunk_size - 1) / chunk_size;
+    for (Index_type c = 0; c < seg_chunks; ++c) {
+      const Index_type begin = RAJA::detail::firstIndex(seg_len, seg_chunks, c);
+      const Index_type end =
+          RAJA::detail::firstIndex(seg_len, seg_chunks, c + 1);
+      chunks.push_back(
+          FusedSegmentChunk{type_id, offset, begin, end, icount + begin});
+    }
+  }
+  return chunks;
+}
+
+template <typename SegmentExecPolicy, typename SpanType, typename Func>
+RAJA_INLINE void fused_chunk_call(resources::Host& host_res,
+                                  SpanType const& span,
+                                  Index_type,
+                                  Func& body,
+                                  std::false_type)
+{
+  using policy::sequential::forall_impl;
+  forall_impl(host_res, SegmentExecPolicy{}, span, body);
+}
+
+template <typename SegmentExecPolicy, typename SpanType, typename Func>
+RAJA_INLINE void fused_chunk_call(resources::Host& host_res,
+                                  SpanType const& span,
+                                  Index_type icount,
+                                  Func& body,
+                                  std::true_type)
+{
+  wrap::forall_Icount(host_res, SegmentExecPolicy{}, span, icount, body);
+}
+
+/*!
+ * Run one chunk of a segment with type id TypeId, an entry of the jump
+ * table of fused_chunks_exec.
+ */
+template <typename SegmentExecPolicy,
+          bool Icount,
+          int TypeId,
+          typename IndexSet,
+          typename Func>
+void fused_chunk_exec(resources::Host& host_res,
+                      IndexSet const& iset,
+                      FusedSegmentChunk const& chunk,
+                      Func& body)
+{
+  auto const& segment = iset.getSegmentByTypeId(
+      std::integral_constant<int, TypeId>{}, chunk.offset);
+  using std::begin;
+  auto span = RAJA::make_span(begin(segment) + chunk.begin,
+                              chunk.end - chunk.begin);
+  fused_chunk_call<SegmentExecPolicy>(host_res,
+                                      span,
+                                      chunk.icount,
+                                      body,
+                                      std::integral_constant<bool, Icount>{});
+}
+
+/*!
+ * Share the chunks among the threads of the enclosing parallel region.
+ * The segment type of each chunk selects its entry in a table of functions
+ * built at compile time, one per segment type, so there is no comparison
+ * chain over the segment types.
+ */
+template <typename SegmentExecPolicy,
+          bool Icount,
+          typename IndexSet,
+          typename Func,
+          camp::idx_t... TypeIds>
+RAJA_INLINE void fused_chunks_exec(resources::Host& host_res,
+                                   IndexSet const& iset,
+                                   std::vector<FusedSegmentChunk> const& chunks,
+                                   Func& body,
+                                   camp::idx_seq<TypeIds...>)
+{
+  using chunk_exec_fn = void (*)(resources::Host&,
+                                 IndexSet const&,
+                                 FusedSegmentChunk const&,
+                                 Func&);
+  static constexpr chunk_exec_fn table[] = {
+      &fused_chunk_exec<SegmentExecPolicy,
+                        Icount,
+                        static_cast<int>(TypeIds),
+                        IndexSet,
+                        Func>...};
+
+  const Index_type num_chunks = chunks.size();
+#pragma omp for schedule(dynamic, 1)
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    table[chunks[c].type_id](host_res, iset, chunks[c], body);
+  }
+}
+
+template <typename SegmentExecPolicy,
+          bool Icount,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE void fused_segments_exec(resources::Host& host_res,
+                                     const TypedIndexSet<SegmentTypes...>& iset,
+                                     LoopBody const& loop_body)
+{
+  const std::vector<FusedSegmentChunk> chunks =
+      make_fused_segment_chunks(iset);
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    fused_chunks_exec<SegmentExecPolicy, Icount>(
+        host_res,
+        iset,
+        chunks,
+        body.get_priv(),
+        camp::make_idx_seq_t<sizeof...(SegmentTypes)>{});
+  });
+}
+
+}  // namespace internal
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over all index set segments in a single omp parallel
+ *         region. Long segments are split into chunks and the chunks of
+ *         every segment are scheduled dynamically as one work list.
+ *         Individual chunks are executed with the segment execution policy,
+ *         which must be a sequential policy such as seq_exec or simd_exec.
+ *
+ ******************************************************************************
+ */
+template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename... SEG_TYPES>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_segments_impl(
+    resources::Host& host_res,
+    ExecPolicy<omp_parallel_fused_segit, SEG_EXEC_POLICY_T>,
+    const TypedIndexSet<SEG_TYPES...>& iset,
+    LOOP_BODY loop_body)
+{
+  internal::fused_segments_exec<SEG_EXEC_POLICY_T, false>(host_res,
+                                                          iset,
+                                                          loop_body);
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename... SEG_TYPES>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_Icount_segments_impl(
+    resources::Host& host_res,
+    ExecPolicy<omp_parallel_fused_segit, SEG_EXEC_POLICY_T>,
+    const TypedIndexSet<SEG_TYPES...>& iset,
+    LOOP_BODY loop_body)
+{
+  internal::fused_segments_exec<SEG_EXEC_POLICY_T, true>(host_res,
+                                                         iset,
+                                                         loop_body);
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
 /*!
  ******************************************************************************
  *
@@ -0,0 +1,238 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter_add and histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_openmp_HPP
+#define RAJA_histogram_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/policy/openmp/atomic.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/sort.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+        \brief each thread adds its updates into a private copy of the bins,
+               then the threads add the copies into out bin range by bin range
+*/
+template <typename IdxIter, typename ValFn, typename OutIter, typename DiffType>
+inline void scatter_privatized(IdxIter idx,
+                               DiffType n,
+                               ValFn val,
+                               OutIter out,
+                               DiffType num_bins,
+                               DiffType num_threads)
+{
+  using RAJA::detail::firstIndex;
+  using value_type = RAJA::detail::IterVal<OutIter>;
+  static_assert(std::is_trivially_destructible<value_type>::value,
+                "privatized scatter_add requires trivially destructible bins");
+
+  // pad each thread's bins to a whole number of cache lines
+  constexpr DiffType per_line =
+      static_cast<DiffType>((RAJA::DATA_ALIGN + sizeof(value_type) - 1) /
+                            sizeof(value_type));
+  const DiffType stride = ((num_bins + per_line - 1) / per_line) * per_line;
+
+  std::unique_ptr<value_type, FreeAligned> priv(
+      RAJA::allocate_aligned_type<value_type>(
+          RAJA::DATA_ALIGN, num_threads * stride * sizeof(value_type)));
+
+  if (priv == nullptr) {
+    RAJA_ABORT_OR_THROW( "scatter_add temporary memory allocation failed" );
+  }
+
+  value_type* bins = priv.get();
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+
+    // first touch this thread's bins
+    value_type* my_bins = bins + pid * stride;
+    for (DiffType b = 0; b < num_bins; ++b) {
+      new (&my_bins[b]) value_type();
+    }
+
+    RAJA::detail::histogram::scatter_range(idx,
+                                           val,
+                                           my_bins,
+                                           firstIndex(n, p, pid),
+                                           firstIndex(n, p, pid + 1));
+
+#pragma omp barrier
+
+    const DiffType b_end = firstIndex(num_bins, p, pid + 1);
+    for (DiffType b = firstIndex(num_bins, p, pid); b < b_end; ++b) {
+      value_type sum = bins[b];
+      for (DiffType t = 1; t < p; ++t) {
+        sum += bins[t * stride + b];
+      }
+      out[b] += sum;
+    }
+  }
+}
+
+/*!
+        \brief add each update directly into out with an atomic add
+*/
+template <typename IdxIter, typename ValFn, typename OutIter, typename DiffType>
+inline void scatter_atomic(IdxIter idx,
+                           DiffType n,
+                           ValFn val,
+                           OutIter out,
+                           DiffType num_threads)
+{
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+#pragma omp parallel for num_threads(static_cast<int>(num_threads))
+  for (DiffType i = 0; i < n; ++i) {
+    RAJA::atomicAdd(RAJA::omp_atomic{},
+                    &out[idx[i]],
+                    static_cast<value_type>(val(i)));
+  }
+}
+
+/*!
+        \brief sort copies of the (bin, value) pairs, then each thread
+               reduces the runs of equal bins that start in its chunk
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+inline void scatter_sort_reduce(const ExecPolicy& exec,
+                                IdxIter idx,
+                                DiffType n,
+                                ValFn val,
+                                OutIter out,
+                                DiffType num_threads)
+{
+  using key_type = camp::decay<decltype(idx[0])>;
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+  ::std::vector<key_type> keys(n);
+  ::std::vector<value_type> vals(n);
+
+#pragma omp parallel for num_threads(static_cast<int>(num_threads))
+  for (DiffType i = 0; i < n; ++i) {
+    keys[i] = idx[i];
+    vals[i] = val(i);
+  }
+
+  RAJA::impl::sort::unstable_pairs(exec,
+                                   keys.begin(),
+                                   keys.end(),
+                                   vals.begin(),
+                                   operators::less<key_type>{});
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+
+    DiffType i_begin, i_end;
+    RAJA::detail::histogram::owned_runs(keys.data(), n, p, pid, i_begin, i_end);
+    RAJA::detail::histogram::reduce_runs(keys.data(), vals.data(), out, i_begin, i_end);
+  }
+}
+
+} // namespace openmp
+
+} // namespace detail
+
+/*!
+        \brief add values into the bins given by indices
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+scatter_add(const ExecPolicy& exec,
+            IdxIter idx,
+            DiffType n,
+            ValFn val,
+            OutIter out,
+            DiffType num_bins,
+            ScatterStrategy strategy)
+{
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+  constexpr DiffType min_iterates_per_thread = static_cast<DiffType>(
+      RAJA::detail::histogram::get_min_iterates_per_thread());
+
+  const DiffType max_threads = omp_get_max_threads();
+  const DiffType num_threads = std::min(
+      (n + min_iterates_per_thread - 1) / min_iterates_per_thread, max_threads);
+
+  if (num_threads <= 1) {
+    RAJA::detail::histogram::scatter_range(idx, val, out, DiffType(0), n);
+    return;
+  }
+
+  switch (RAJA::detail::histogram::select_strategy<value_type>(
+              strategy, idx, n, num_bins, num_threads)) {
+    case ScatterStrategy::sort_reduce:
+      detail::openmp::scatter_sort_reduce(exec, idx, n, val, out, num_threads);
+      break;
+    case ScatterStrategy::atomic:
+      detail::openmp::scatter_atomic(idx, n, val, out, num_threads);
+      break;
+    default:
+      detail::openmp::scatter_privatized(idx, n, val, out, num_bins, num_threads);
+      break;
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
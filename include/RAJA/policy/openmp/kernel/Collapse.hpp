@@ -22,6 +22,15 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/pattern/kernel/Collapse.hpp"
@@ -41,9 +50,268 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+/*!
+ * Policy for a Collapse statement that splits the collapsed iteration space
+ * into tiles of TileSizes, one size per collapsed argument, and gives each
+ * thread a contiguous range of whole tiles in row-major tile order.
+ */
+template <camp::idx_t... TileSizes>
+struct omp_parallel_collapse_tile_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+};
+
 namespace internal
 {
 
+/////////
+// Collapsing any number of loops
+/////////
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct collapse_segment_types {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Arg, camp::idx_t... Args>
+struct collapse_segment_types<Types, Data, Arg, Args...> {
+  using type = typename collapse_segment_types<
+      setSegmentTypeFromData<Types, Arg, Data>,
+      Data,
+      Args...>::type;
+};
+
+/*!
+ * Runs the enclosed statements over boxes and row-major ranges of the
+ * collapsed iteration space, stepping the innermost argument in a plain
+ * loop and carrying into the outer arguments like an odometer.
+ */
+template <typename StmtList, typename Types, typename ArgList, typename Positions>
+struct OmpCollapseN;
+
+template <typename... EnclosedStmts,
+          typename Types,
+          camp::idx_t... Args,
+          camp::idx_t... Pos>
+struct OmpCollapseN<camp::list<EnclosedStmts...>,
+                    Types,
+                    ArgList<Args...>,
+                    camp::idx_seq<Pos...>> {
+
+  static constexpr camp::idx_t num_args = sizeof...(Args);
+  static constexpr camp::idx_t inner_arg =
+      camp::seq_at<num_args - 1, camp::idx_seq<Args...>>::value;
+
+  template <typename Data>
+  using diff_t =
+      typename std::common_type<segment_diff_type<Args, camp::decay<Data>>...>::type;
+
+  template <typename Data>
+  using types_t =
+      typename collapse_segment_types<Types, camp::decay<Data>, Args...>::type;
+
+  template <typename Data>
+  using index_t = std::array<diff_t<Data>, sizeof...(Args)>;
+
+  template <typename Data>
+  static RAJA_INLINE index_t<Data> lengths(Data const &data)
+  {
+    return index_t<Data>{{static_cast<diff_t<Data>>(
+        segment_length<Args>(data))...}};
+  }
+
+  //! Run the innermost argument over [begin, end) with the others at idx
+  template <typename Data, typename Index>
+  static RAJA_INLINE void exec_inner(Data &data,
+                                     Index const &idx,
+                                     typename Index::value_type begin,
+                                     typename Index::value_type end)
+  {
+    camp::sink((data.template assign_offset<Args>(idx[Pos]), 0)...);
+    for (auto i = begin; i < end; ++i) {
+      data.template assign_offset<inner_arg>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>, types_t<Data>>(data);
+    }
+  }
+
+  //! Step the outer arguments of idx to the next row of the box [lo, hi)
+  template <typename Index>
+  static RAJA_INLINE void next_row(Index &idx, Index const &lo, Index const &hi)
+  {
+    for (camp::idx_t d = num_args - 2; d >= 0; --d) {
+      if (++idx[d] < hi[d]) {
+        return;
+      }
+      idx[d] = lo[d];
+    }
+  }
+
+  //! Run the row-major range [first, last) of the iteration space of len
+  template <typename Data, typename Index>
+  static RAJA_INLINE void exec_range(Data &data,
+                                     Index const &len,
+                                     typename Index::value_type first,
+                                     typename Index::value_type last)
+  {
+    using diff_type = typename Index::value_type;
+    if (first >= last) {
+      return;
+    }
+
+    Index idx;
+    diff_type rem = first;
+    for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+      idx[d] = rem % len[d];
+      rem /= len[d];
+    }
+
+    const Index lo{};
+    for (diff_type left = last - first; left > 0;) {
+      const diff_type row_begin = idx[num_args - 1];
+      const diff_type row_end = std::min(len[num_args - 1], row_begin + left);
+      exec_inner(data, idx, row_begin, row_end);
+      left -= row_end - row_begin;
+      idx[num_args - 1] = 0;
+      next_row(idx, lo, len);
+    }
+  }
+
+  //! Run every iterate in the box [lo, hi) in row-major order
+  template <typename Data, typename Index>
+  static RAJA_INLINE void exec_box(Data &data, Index const &lo, Index const &hi)
+  {
+    camp::idx_t rows = 1;
+    for (camp::idx_t d = 0; d < num_args - 1; ++d) {
+      rows *= hi[d] - lo[d];
+    }
+
+    Index idx = lo;
+    for (camp::idx_t r = 0; r < rows; ++r) {
+      exec_inner(data, idx, lo[num_args - 1], hi[num_args - 1]);
+      next_row(idx, lo, hi);
+    }
+  }
+};
+
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types> {
+
+  using collapse_t = OmpCollapseN<camp::list<EnclosedStmts...>,
+                                  Types,
+                                  ArgList<Args...>,
+                                  camp::make_idx_seq_t<sizeof...(Args)>>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using diff_t = typename collapse_t::template diff_t<Data>;
+
+    const auto len = collapse_t::lengths(data);
+    diff_t total = 1;
+    for (diff_t l : len) {
+      total *= l;
+    }
+    if (total <= 0) {
+      return;
+    }
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      using RAJA::detail::firstIndex;
+      const diff_t p = omp_get_num_threads();
+      const diff_t t = omp_get_thread_num();
+
+      auto& private_data = privatizer.get_priv();
+      collapse_t::exec_range(private_data,
+                             len,
+                             firstIndex(total, p, t),
+                             firstIndex(total, p, t + 1));
+    }
+  }
+};
+
+template <camp::idx_t... TileSizes,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_tile_exec<TileSizes...>,
+                        ArgList<Args...>,
+                        EnclosedStmts...>, Types> {
+
+  static_assert(sizeof...(TileSizes) == sizeof...(Args),
+                "omp_parallel_collapse_tile_exec needs one tile size per "
+                "collapsed argument");
+
+  using collapse_t = OmpCollapseN<camp::list<EnclosedStmts...>,
+                                  Types,
+                                  ArgList<Args...>,
+                                  camp::make_idx_seq_t<sizeof...(Args)>>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using diff_t = typename collapse_t::template diff_t<Data>;
+    using index_t = typename collapse_t::template index_t<Data>;
+    constexpr camp::idx_t num_args = sizeof...(Args);
+
+    const index_t len = collapse_t::lengths(data);
+    const index_t tile{{static_cast<diff_t>(TileSizes)...}};
+
+    index_t num_tiles;
+    diff_t total = 1;
+    for (camp::idx_t d = 0; d < num_args; ++d) {
+      num_tiles[d] = (len[d] + tile[d] - 1) / tile[d];
+      total *= num_tiles[d];
+    }
+    if (total <= 0) {
+      return;
+    }
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      using RAJA::detail::firstIndex;
+      const diff_t p = omp_get_num_threads();
+      const diff_t t = omp_get_thread_num();
+      const diff_t first = firstIndex(total, p, t);
+      const diff_t last = firstIndex(total, p, t + 1);
+
+      auto& private_data = privatizer.get_priv();
+
+      index_t tile_idx;
+      diff_t rem = first;
+      for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+        tile_idx[d] = rem % num_tiles[d];
+        rem /= num_tiles[d];
+      }
+
+      for (diff_t b = first; b < last; ++b) {
+        index_t lo, hi;
+        for (camp::idx_t d = 0; d < num_args; ++d) {
+          lo[d] = tile_idx[d] * tile[d];
+          hi[d] = std::min(lo[d] + tile[d], len[d]);
+        }
+        collapse_t::exec_box(private_data, lo, hi);
+
+        for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+          if (++tile_idx[d] < num_tiles[d]) {
+            break;
+          }
+          tile_idx[d] = 0;
+        }
+      }
+    }
+  }
+};
+
+
 /////////
 // Collapsing two loops
 /////////
@@ -158,6 +158,20 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 
 using omp_parallel_segit = omp_parallel_for_segit;
 
+///
+/// Runs every segment of an index set in a single parallel region. Long
+/// segments are split into chunks, and all segments and chunks are
+/// scheduled as one work list, so an index set of many small segments
+/// does not pay for a parallel region per segment.
+///
+struct omp_parallel_fused_segit
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+};
+
 struct omp_taskgraph_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
@@ -206,6 +220,7 @@ using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
 using policy::omp::omp_parallel_for_exec;
 using policy::omp::omp_parallel_for_segit;
+using policy::omp::omp_parallel_fused_segit;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
@@ -31,6 +31,7 @@
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/Operators.hpp"
 
 namespace RAJA
 {
@@ -118,6 +119,129 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
   }
 }
 
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary function applied to each input as it is read
+
+   Each thread reduces its block of the transformed input, the block sums are
+   scanned, and each thread then scans its block again straight into the
+   output, so no temporary copy of the input is made.
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_inclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename std::decay<decltype(g(*begin))>::type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  if (p0 <= 1) {
+    transform_inclusive(::RAJA::loop_exec{}, begin, end, out, f, g);
+    return;
+  }
+  ::std::vector<Value> sums(p0, Value());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    if (idx_begin != idx_end) {
+      Value agg = g(begin[idx_begin]);
+      for (auto i = idx_begin + 1; i < idx_end; ++i) {
+        agg = f(agg, g(begin[i]));
+      }
+      sums[pid] = agg;
+    }
+#pragma omp barrier
+#pragma omp single
+    for (int t = 1; t < p; ++t) {
+      sums[t] = f(sums[t - 1], sums[t]);
+    }
+    if (idx_begin != idx_end) {
+      Value agg = g(begin[idx_begin]);
+      if (pid > 0) agg = f(sums[pid - 1], agg);
+      out[idx_begin] = agg;
+      for (auto i = idx_begin + 1; i < idx_end; ++i) {
+        agg = f(agg, g(begin[i]));
+        out[i] = agg;
+      }
+    }
+  }
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary function applied to each input as it is read, and initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_exclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  if (p0 <= 1) {
+    transform_exclusive(::RAJA::loop_exec{}, begin, end, out, f, g, v);
+    return;
+  }
+  ::std::vector<ValueT> sums(p0, v);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    if (idx_begin != idx_end) {
+      ValueT agg = g(begin[idx_begin]);
+      for (auto i = idx_begin + 1; i < idx_end; ++i) {
+        agg = f(agg, g(begin[i]));
+      }
+      sums[pid] = agg;
+    }
+#pragma omp barrier
+#pragma omp single
+    {
+      ValueT agg = v;
+      for (int t = 0; t < p; ++t) {
+        ValueT s = sums[t];
+        sums[t] = agg;
+        agg = f(agg, s);
+      }
+    }
+    ValueT agg = sums[pid];
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      auto t = g(begin[i]);
+      out[i] = agg;
+      agg = f(agg, t);
+    }
+  }
+}
+
 /*!
         \brief explicit inclusive scan given input range, output, function, and
    initial value
@@ -130,9 +254,9 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
     OutIter out,
     BinFn f)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + distance(begin, end), f);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_inclusive(
+      exec, begin, end, out, f, ::RAJA::operators::identity<Value>{});
 }
 
 /*!
@@ -152,9 +276,9 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + distance(begin, end), f, v);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_exclusive(
+      exec, begin, end, out, f, ::RAJA::operators::identity<Value>{}, v);
 }
 
 }  // namespace scan
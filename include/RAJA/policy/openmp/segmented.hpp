@@ -0,0 +1,329 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce and scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_openmp_HPP
+#define RAJA_segmented_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/loop/segmented.hpp"
+#include "RAJA/pattern/detail/segmented.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace segmented
+{
+
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+        \brief number of threads worth using for n elements
+*/
+template <typename DiffType>
+inline DiffType get_num_threads(DiffType n)
+{
+  constexpr DiffType min_iterates_per_thread = static_cast<DiffType>(
+      RAJA::detail::segmented::get_min_iterates_per_thread());
+
+  const DiffType max_threads = omp_get_max_threads();
+  return std::min((n + min_iterates_per_thread - 1) / min_iterates_per_thread,
+                  max_threads);
+}
+
+/*!
+        \brief add the carry of each chunk's earlier chunks into the chunk,
+               tails[t] is replaced by the carry into chunk t
+*/
+template <typename BinFn, typename T, typename DiffType>
+inline void scan_carries(BinFn f,
+                         const char* has_head,
+                         T* tails,
+                         DiffType num_chunks)
+{
+  T run = tails[0];
+  for (DiffType t = 1; t < num_chunks; ++t) {
+    T tail = tails[t];
+    tails[t] = run;
+    run = has_head[t] ? tail : f(run, tail);
+  }
+}
+
+} // namespace openmp
+
+} // namespace detail
+
+/*!
+        \brief reduce each segment [offsets[s], offsets[s+1]) of vals into
+               out[s], empty segments are set to identity
+
+        Threads split the elements evenly, so the work is balanced however
+        uneven the segments are. Segments split between threads are
+        finished by the thread they start in.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+reduce(const ExecPolicy&,
+       Iter vals,
+       OffIter offsets,
+       DiffType num_segments,
+       OutIter out,
+       BinFn f,
+       T identity)
+{
+  using RAJA::detail::segmented::chunk_segments;
+  using RAJA::detail::segmented::reduce_chunk;
+  using RAJA::detail::segmented::reduce_chunk_fixup;
+
+  const DiffType n = offsets[num_segments] - offsets[0];
+  const DiffType num_threads = detail::openmp::get_num_threads(n);
+
+  if (num_threads <= 1) {
+    reduce(::RAJA::loop_exec{}, vals, offsets, num_segments, out, f, identity);
+    return;
+  }
+
+  ::std::vector<DiffType> carry_seg(num_threads);
+  ::std::vector<T> carry(num_threads, identity);
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+
+    DiffType lo, hi, s_begin, s_end;
+    chunk_segments(offsets, num_segments, p, pid, lo, hi, s_begin, s_end);
+
+    reduce_chunk(vals, offsets, lo, hi, s_begin, s_end, out, f, identity,
+                 carry_seg[pid], carry[pid]);
+
+#pragma omp barrier
+
+    reduce_chunk_fixup(offsets, hi, s_begin, s_end, out, f, p, pid,
+                       carry_seg.data(), carry.data());
+  }
+}
+
+/*!
+        \brief inclusive scan of n values that restarts at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+inclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f)
+{
+  using RAJA::detail::firstIndex;
+  using Value = RAJA::detail::IterVal<OutIter>;
+
+  const DiffType num_threads = detail::openmp::get_num_threads(n);
+
+  if (num_threads <= 1) {
+    inclusive(::RAJA::loop_exec{}, in, n, heads, out, f);
+    return;
+  }
+
+  ::std::vector<char> has_head(num_threads);
+  ::std::vector<Value> tails(num_threads);
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+    const DiffType lo = firstIndex(n, p, pid);
+    const DiffType hi = firstIndex(n, p, pid + 1);
+
+    bool hh;
+    RAJA::detail::segmented::inclusive_chunk(
+        in, heads, out, f, lo, hi, hh, tails[pid]);
+    has_head[pid] = hh;
+
+#pragma omp barrier
+#pragma omp single
+    detail::openmp::scan_carries(f, has_head.data(), tails.data(), p);
+
+    if (pid > 0) {
+      RAJA::detail::segmented::scan_chunk_fixup(
+          heads, out, f, tails[pid], lo, hi);
+    }
+  }
+}
+
+/*!
+        \brief exclusive scan of n values that restarts from v at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+exclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f,
+          T v)
+{
+  using RAJA::detail::firstIndex;
+
+  const DiffType num_threads = detail::openmp::get_num_threads(n);
+
+  if (num_threads <= 1) {
+    exclusive(::RAJA::loop_exec{}, in, n, heads, out, f, v);
+    return;
+  }
+
+  ::std::vector<char> has_head(num_threads);
+  ::std::vector<T> tails(num_threads, v);
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+    const DiffType lo = firstIndex(n, p, pid);
+    const DiffType hi = firstIndex(n, p, pid + 1);
+
+    bool hh;
+    RAJA::detail::segmented::exclusive_chunk(
+        in, heads, out, f, v, lo, hi, hh, tails[pid]);
+    has_head[pid] = hh;
+
+#pragma omp barrier
+#pragma omp single
+    detail::openmp::scan_carries(f, has_head.data(), tails.data(), p);
+
+    if (pid > 0) {
+      RAJA::detail::segmented::scan_chunk_fixup(
+          heads, out, f, tails[pid], lo, hi);
+    }
+  }
+}
+
+/*!
+        \brief write the key and reduced value of each run of equal keys,
+               returns the number of runs
+
+        Threads count the runs starting in their chunk of keys, then write
+        their runs at the offsets given by a scan of the counts in a single
+        pass over the keys and values. Runs split between threads are
+        finished by the thread they start in.
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValFn,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if_t<DiffType, type_traits::is_openmp_policy<ExecPolicy>>
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys,
+              DiffType n,
+              ValFn vals,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using RAJA::detail::firstIndex;
+  using Value = RAJA::detail::IterVal<ValOutIter>;
+
+  const DiffType num_threads = detail::openmp::get_num_threads(n);
+
+  if (num_threads <= 1) {
+    return reduce_by_key(
+        ::RAJA::loop_exec{}, keys, n, vals, keys_out, vals_out, f);
+  }
+
+  const RAJA::detail::segmented::KeyHeads<KeyIter> heads{keys};
+
+  ::std::vector<DiffType> head_counts(num_threads);
+  ::std::vector<DiffType> positions(num_threads + 1);
+  ::std::vector<Value> carry(num_threads);
+  DiffType num_runs = 0;
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+  {
+    const DiffType p = omp_get_num_threads();
+    const DiffType pid = omp_get_thread_num();
+    const DiffType lo = firstIndex(n, p, pid);
+    const DiffType hi = firstIndex(n, p, pid + 1);
+
+    head_counts[pid] = RAJA::detail::segmented::count_heads(heads, lo, hi);
+
+#pragma omp barrier
+#pragma omp single
+    {
+      positions[0] = 0;
+      for (DiffType t = 0; t < p; ++t) {
+        positions[t + 1] = positions[t] + head_counts[t];
+      }
+      num_runs = positions[p];
+    }
+
+    RAJA::detail::segmented::reduce_by_key_chunk(
+        keys, vals, lo, hi, positions[pid], keys_out, vals_out, f, carry[pid]);
+
+#pragma omp barrier
+
+    RAJA::detail::segmented::reduce_by_key_fixup(keys, n, hi, positions[pid + 1],
+                                                 vals_out, f, p, pid,
+                                                 head_counts.data(),
+                                                 carry.data());
+  }
+
+  return num_runs;
+}
+
+}  // namespace segmented
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
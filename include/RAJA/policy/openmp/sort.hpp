@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
 
 #include <omp.h>
 
@@ -30,6 +31,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -184,6 +187,210 @@ void sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief merge pairs of neighboring sorted runs of width runs from src
+               into dst, where run r is [firstIndex(n, num_runs, r),
+               firstIndex(n, num_runs, r+1)), with each thread of the
+               enclosing parallel region writing an equal part of dst found
+               by merge path
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+inline void merge_runs_parallel_region(SrcIter src,
+                                       DstIter dst,
+                                       RAJA::detail::IterDiff<SrcIter> n,
+                                       RAJA::detail::IterDiff<SrcIter> num_runs,
+                                       RAJA::detail::IterDiff<SrcIter> width,
+                                       Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const diff_type num_threads = omp_get_num_threads();
+  const diff_type thread_id = omp_get_thread_num();
+
+  // this thread writes dst range [o_begin, o_end)
+  const diff_type o_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type o_end   = firstIndex(n, num_threads, thread_id + 1);
+
+  for (diff_type run = 0; run < num_runs; run += 2*width) {
+
+    const diff_type i_begin  = firstIndex(n, num_runs, run);
+    const diff_type i_middle = firstIndex(n, num_runs, std::min(run + width,   num_runs));
+    const diff_type i_end    = firstIndex(n, num_runs, std::min(run + 2*width, num_runs));
+
+    if (i_end <= o_begin || o_end <= i_begin) {
+      continue;
+    }
+
+    // part [d_begin, d_end) of the merge of [i_begin, i_middle) and
+    // [i_middle, i_end) belongs to this thread
+    const diff_type a_len = i_middle - i_begin;
+    const diff_type b_len = i_end - i_middle;
+    const diff_type d_begin = std::max(o_begin, i_begin) - i_begin;
+    const diff_type d_end   = std::min(o_end,   i_end)   - i_begin;
+
+    const diff_type a_begin = RAJA::detail::merge_path_split(
+        src + i_begin, a_len, src + i_middle, b_len, d_begin, comp);
+    const diff_type a_end = RAJA::detail::merge_path_split(
+        src + i_begin, a_len, src + i_middle, b_len, d_end, comp);
+
+    RAJA::detail::merge_move(src + i_begin + a_begin,
+                             src + i_begin + a_end,
+                             src + i_middle + (d_begin - a_begin),
+                             src + i_middle + (d_end - a_end),
+                             dst + i_begin + d_begin,
+                             comp);
+  }
+}
+
+/*!
+        \brief stable sort given range using comparison function by sorting
+               a part per thread and merging the parts in parallel with merge
+               path, moving between the range and one buffer allocated once
+               with scratch_allocator
+*/
+template <typename Sorter, typename Iter, typename Compare, typename Allocator>
+inline
+void stable_sort(Sorter sorter,
+                 Iter begin,
+                 Iter end,
+                 Compare comp,
+                 Allocator const& scratch_allocator)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
+
+  const diff_type n = end - begin;
+
+  if (n <= min_iterates_per_task) {
+
+    sorter(begin, end, comp, scratch_allocator);
+
+  } else {
+
+    const diff_type max_threads = omp_get_max_threads();
+
+    const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
+
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    RAJA::detail::SortScratch<value_type, Allocator> scratch(scratch_allocator, n);
+
+    value_type* copyarr = scratch.data;
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+    {
+      using RAJA::detail::firstIndex;
+
+      const diff_type num_threads = omp_get_num_threads();
+      const diff_type thread_id = omp_get_thread_num();
+
+      const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+      const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
+
+      // this thread sorts range [i_begin, i_end) merging through its part
+      // of the buffer, then moves it into the buffer
+      diff_type constructed = 0;
+      RAJA::detail::merge_sort(begin + i_begin, begin + i_end, comp,
+                               copyarr + i_begin, constructed);
+
+      for (diff_type i = i_begin; i < i_begin + constructed; ++i) {
+        copyarr[i] = std::move(begin[i]);
+      }
+      for (diff_type i = i_begin + constructed; i < i_end; ++i) {
+        new(&copyarr[i]) value_type(std::move(begin[i]));
+      }
+
+      // merge runs, switching between buffer and range at each level
+      bool copyvalid = true;
+      for (diff_type width = 1; width < num_threads; width *= 2) {
+
+#pragma omp barrier
+
+        if (copyvalid) {
+          merge_runs_parallel_region(copyarr, begin, n, num_threads, width, comp);
+        } else {
+          merge_runs_parallel_region(begin, copyarr, n, num_threads, width, comp);
+        }
+        copyvalid = !copyvalid;
+      }
+
+#pragma omp barrier
+
+      if (copyvalid) {
+        std::move(copyarr + i_begin, copyarr + i_end, begin + i_begin);
+      }
+    }
+
+    // every object in the buffer was constructed
+    scratch.constructed = n;
+  }
+}
+
+/*!
+        \brief stable sort given range using comparison function by sorting
+               a part per thread and merging the parts in parallel
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+void stable_sort(Sorter sorter,
+                 Iter begin,
+                 Iter end,
+                 Compare comp)
+{
+  openmp::stable_sort(sorter, begin, end, comp,
+                      RAJA::detail::SortScratchAllocator<char>{});
+}
+
+/*!
+        \brief Functional that sorts in parallel with sort
+*/
+struct UnstableParallelSorter
+{
+  template < typename... Args >
+  RAJA_INLINE
+  void operator()(Args&&... args) const
+  {
+    openmp::sort(UnstableSorter{}, std::forward<Args>(args)...);
+  }
+};
+
+/*!
+        \brief Functional that sorts in parallel with stable_sort
+*/
+struct StableParallelSorter
+{
+  template < typename... Args >
+  RAJA_INLINE
+  void operator()(Args&&... args) const
+  {
+    openmp::stable_sort(StableSorter{}, std::forward<Args>(args)...);
+  }
+};
+
+/*!
+        \brief Functional that runs body(i) for i in [0, n) in parallel
+*/
+struct ParallelFor
+{
+  template < typename DiffType, typename Body >
+  RAJA_INLINE
+  void operator()(DiffType n, Body const& body) const
+  {
+#pragma omp parallel for
+    for (DiffType i = 0; i < n; ++i) {
+      body(i);
+    }
+  }
+
+  RAJA_INLINE
+  int num_chunks() const
+  {
+    return omp_get_max_threads();
+  }
+};
+
 } // namespace openmp
 
 } // namespace detail
@@ -211,7 +418,7 @@ stable(const ExecPolicy&,
             Iter end,
             Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::stable_sort(detail::StableSorter{}, begin, end, comp);
 }
 
 /*!
@@ -245,7 +452,152 @@ stable_pairs(const ExecPolicy&,
   auto begin  = RAJA::zip(keys_begin, vals_begin);
   auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
   using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::stable_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
+/*!
+        \brief sort keys using comparison function and reorder each range
+               of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+unstable_by_key(const ExecPolicy&,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                Compare comp,
+                ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::openmp::UnstableParallelSorter{}, detail::openmp::ParallelFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief stable sort keys using comparison function and reorder each
+               range of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+stable_by_key(const ExecPolicy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              Compare comp,
+              ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::openmp::StableParallelSorter{}, detail::openmp::ParallelFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief partially sort given range using comparison function so
+               [begin, middle) holds its smallest items in sorted order
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+partial(const ExecPolicy&,
+        Iter begin,
+        Iter middle,
+        Iter end,
+        Compare comp)
+{
+  detail::sort_partial(detail::openmp::UnstableParallelSorter{}, detail::openmp::ParallelFor{},
+                       begin, middle, end, comp);
+}
+
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+nth_element(const ExecPolicy&,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp)
+{
+  detail::select_nth(detail::openmp::ParallelFor{}, begin, nth, end, comp);
+}
+
+/*!
+        \brief copy k smallest items of given range in sorted order to out
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+top_k(const ExecPolicy&,
+      Iter begin,
+      Iter end,
+      RAJA::detail::IterDiff<Iter> k,
+      OutIter out,
+      Compare comp)
+{
+  detail::top_k(detail::openmp::UnstableParallelSorter{}, detail::openmp::ParallelFor{},
+                begin, end, k, out, comp);
+}
+
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+unstable_segmented(const ExecPolicy&,
+                   Iter begin,
+                   OffsetIter offsets_begin,
+                   OffsetIter offsets_end,
+                   Compare comp)
+{
+  detail::segmented_sort(detail::openmp::UnstableParallelSorter{}, detail::openmp::ParallelFor{},
+                         begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+unstable_segmented_pairs(const ExecPolicy&,
+                         KeyIter keys_begin,
+                         ValIter vals_begin,
+                         OffsetIter offsets_begin,
+                         OffsetIter offsets_end,
+                         Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::segmented_sort(detail::openmp::UnstableParallelSorter{}, detail::openmp::ParallelFor{},
+                         begin, offsets_begin, offsets_end,
+                         RAJA::compare_first<zip_ref>(comp));
+}
+
+/*!
+        \brief sort given range using comparison function, ignoring the
+               scratch memory allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+unstable(const ExecPolicy& p,
+         Iter begin,
+         Iter end,
+         Compare comp,
+         Allocator const&)
+{
+  RAJA::impl::sort::unstable(p, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function, merging
+               through scratch memory allocated with scratch_allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>>
+stable(const ExecPolicy&,
+       Iter begin,
+       Iter end,
+       Compare comp,
+       Allocator const& scratch_allocator)
+{
+  detail::openmp::stable_sort(detail::StableSorter{}, begin, end, comp, scratch_allocator);
 }
 
 }  // namespace sort
@@ -22,6 +22,8 @@
 
 #include "RAJA/policy/sequential/atomic.hpp"
 #include "RAJA/policy/sequential/forall.hpp"
+#include "RAJA/policy/sequential/histogram.hpp"
+#include "RAJA/policy/sequential/segmented.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/policy/sequential/reduce.hpp"
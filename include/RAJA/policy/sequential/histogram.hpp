@@ -0,0 +1,63 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter_add and histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_sequential_HPP
+#define RAJA_histogram_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief add values into the bins given by indices
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+scatter_add(const ExecPolicy&,
+            IdxIter idx,
+            DiffType n,
+            ValFn val,
+            OutIter out,
+            DiffType num_bins,
+            ScatterStrategy strategy)
+{
+  RAJA::impl::histogram::scatter_add(::RAJA::loop_exec{}, idx, n, val, out, num_bins, strategy);
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
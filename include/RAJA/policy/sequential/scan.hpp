@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
 
 #include "RAJA/util/macros.hpp"
 
@@ -130,6 +131,73 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary function applied to each input as it is read
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+transform_inclusive(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::decay<decltype(g(*begin))>::type;
+  ValueT agg = g(begin[0]);
+  out[0] = agg;
+
+  RAJA_NO_SIMD
+  for (DistanceT i = 1; i < n; ++i) {
+    agg = f(agg, g(begin[i]));
+    out[i] = agg;
+  }
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary function applied to each input as it is read, and initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+transform_exclusive(
+    const ExecPolicy &,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g,
+    T v)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  T agg = v;
+
+  RAJA_NO_SIMD
+  for (DistanceT i = 0; i < n; ++i) {
+    auto t = g(begin[i]);
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+}
+
 }  // namespace scan
 
 }  // namespace impl
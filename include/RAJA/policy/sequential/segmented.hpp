@@ -0,0 +1,131 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce and scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_sequential_HPP
+#define RAJA_segmented_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/loop/segmented.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace segmented
+{
+
+/*!
+        \brief reduce each segment [offsets[s], offsets[s+1]) of vals into
+               out[s], empty segments are set to identity
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+reduce(const ExecPolicy&,
+       Iter vals,
+       OffIter offsets,
+       DiffType num_segments,
+       OutIter out,
+       BinFn f,
+       T identity)
+{
+  RAJA::impl::segmented::reduce(::RAJA::loop_exec{}, vals, offsets, num_segments, out, f, identity);
+}
+
+/*!
+        \brief inclusive scan of n values that restarts at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+inclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f)
+{
+  RAJA::impl::segmented::inclusive(::RAJA::loop_exec{}, in, n, heads, out, f);
+}
+
+/*!
+        \brief exclusive scan of n values that restarts from v at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+exclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f,
+          T v)
+{
+  RAJA::impl::segmented::exclusive(::RAJA::loop_exec{}, in, n, heads, out, f, v);
+}
+
+/*!
+        \brief write the key and reduced value of each run of equal keys,
+               returns the number of runs
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValFn,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if_t<DiffType, type_traits::is_sequential_policy<ExecPolicy>>
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys,
+              DiffType n,
+              ValFn vals,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  return RAJA::impl::segmented::reduce_by_key(::RAJA::loop_exec{}, keys, n, vals, keys_out, vals_out, f);
+}
+
+}  // namespace segmented
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -92,6 +92,143 @@ stable_pairs(const ExecPolicy&,
   RAJA::impl::sort::stable_pairs(::RAJA::loop_exec{}, keys_begin, keys_end, vals_begin, comp);
 }
 
+/*!
+        \brief sort keys using comparison function and reorder each range
+               of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_by_key(const ExecPolicy&,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                Compare comp,
+                ValIters... vals_begins)
+{
+  RAJA::impl::sort::unstable_by_key(::RAJA::loop_exec{}, keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief stable sort keys using comparison function and reorder each
+               range of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable_by_key(const ExecPolicy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              Compare comp,
+              ValIters... vals_begins)
+{
+  RAJA::impl::sort::stable_by_key(::RAJA::loop_exec{}, keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief partially sort given range using comparison function so
+               [begin, middle) holds its smallest items in sorted order
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+partial(const ExecPolicy&,
+        Iter begin,
+        Iter middle,
+        Iter end,
+        Compare comp)
+{
+  RAJA::impl::sort::partial(::RAJA::loop_exec{}, begin, middle, end, comp);
+}
+
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+nth_element(const ExecPolicy&,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp)
+{
+  RAJA::impl::sort::nth_element(::RAJA::loop_exec{}, begin, nth, end, comp);
+}
+
+/*!
+        \brief copy k smallest items of given range in sorted order to out
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+top_k(const ExecPolicy&,
+      Iter begin,
+      Iter end,
+      RAJA::detail::IterDiff<Iter> k,
+      OutIter out,
+      Compare comp)
+{
+  RAJA::impl::sort::top_k(::RAJA::loop_exec{}, begin, end, k, out, comp);
+}
+
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_segmented(const ExecPolicy&,
+                   Iter begin,
+                   OffsetIter offsets_begin,
+                   OffsetIter offsets_end,
+                   Compare comp)
+{
+  RAJA::impl::sort::unstable_segmented(::RAJA::loop_exec{}, begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_segmented_pairs(const ExecPolicy&,
+                         KeyIter keys_begin,
+                         ValIter vals_begin,
+                         OffsetIter offsets_begin,
+                         OffsetIter offsets_end,
+                         Compare comp)
+{
+  RAJA::impl::sort::unstable_segmented_pairs(::RAJA::loop_exec{}, keys_begin, vals_begin,
+                                             offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief sort given range using comparison function, ignoring the
+               scratch memory allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable(const ExecPolicy& p,
+         Iter begin,
+         Iter end,
+         Compare comp,
+         Allocator const&)
+{
+  RAJA::impl::sort::unstable(p, begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function, merging
+               through scratch memory allocated with scratch_allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable(const ExecPolicy&,
+       Iter begin,
+       Iter end,
+       Compare comp,
+       Allocator const& scratch_allocator)
+{
+  RAJA::impl::sort::stable(::RAJA::loop_exec{}, begin, end, comp, scratch_allocator);
+}
+
 }  // namespace sort
 
 }  // namespace impl
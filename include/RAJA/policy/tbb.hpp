@@ -23,6 +23,8 @@
 #if defined(RAJA_ENABLE_TBB)
 
 #include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/histogram.hpp"
+#include "RAJA/policy/tbb/segmented.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
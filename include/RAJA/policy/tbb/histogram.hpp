@@ -0,0 +1,201 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter_add and histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_tbb_HPP
+#define RAJA_histogram_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/policy/tbb/sort.hpp"
+#include "RAJA/policy/loop/histogram.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+namespace tbb
+{
+
+/*!
+        \brief each worker adds its updates into a private copy of the bins,
+               then the copies are added into out bin range by bin range
+*/
+template <typename IdxIter, typename ValFn, typename OutIter, typename DiffType>
+inline void scatter_privatized(IdxIter idx,
+                               DiffType n,
+                               ValFn val,
+                               OutIter out,
+                               DiffType num_bins)
+{
+  using value_type = RAJA::detail::IterVal<OutIter>;
+  using bins_type = ::std::vector<value_type>;
+
+  ::tbb::enumerable_thread_specific<bins_type> priv(
+      static_cast<size_t>(num_bins), value_type());
+
+  ::tbb::parallel_for(::tbb::blocked_range<DiffType>(0, n),
+                      [&](const ::tbb::blocked_range<DiffType>& r) {
+                        RAJA::detail::histogram::scatter_range(
+                            idx, val, priv.local().data(), r.begin(), r.end());
+                      });
+
+  ::tbb::parallel_for(::tbb::blocked_range<DiffType>(0, num_bins),
+                      [&](const ::tbb::blocked_range<DiffType>& r) {
+                        for (const bins_type& bins : priv) {
+                          for (DiffType b = r.begin(); b < r.end(); ++b) {
+                            out[b] += bins[b];
+                          }
+                        }
+                      });
+}
+
+/*!
+        \brief add each update directly into out with an atomic add
+*/
+template <typename IdxIter, typename ValFn, typename OutIter, typename DiffType>
+inline void scatter_atomic(IdxIter idx, DiffType n, ValFn val, OutIter out)
+{
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+  ::tbb::parallel_for(::tbb::blocked_range<DiffType>(0, n),
+                      [&](const ::tbb::blocked_range<DiffType>& r) {
+                        for (DiffType i = r.begin(); i < r.end(); ++i) {
+                          RAJA::atomicAdd(RAJA::builtin_atomic{},
+                                          &out[idx[i]],
+                                          static_cast<value_type>(val(i)));
+                        }
+                      });
+}
+
+/*!
+        \brief sort copies of the (bin, value) pairs, then reduce the runs of
+               equal bins with each run owned by the chunk it starts in
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+inline void scatter_sort_reduce(const ExecPolicy& exec,
+                                IdxIter idx,
+                                DiffType n,
+                                ValFn val,
+                                OutIter out,
+                                DiffType num_chunks)
+{
+  using key_type = camp::decay<decltype(idx[0])>;
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+  ::std::vector<key_type> keys(n);
+  ::std::vector<value_type> vals(n);
+
+  ::tbb::parallel_for(::tbb::blocked_range<DiffType>(0, n),
+                      [&](const ::tbb::blocked_range<DiffType>& r) {
+                        for (DiffType i = r.begin(); i < r.end(); ++i) {
+                          keys[i] = idx[i];
+                          vals[i] = val(i);
+                        }
+                      });
+
+  RAJA::impl::sort::unstable_pairs(exec,
+                                   keys.begin(),
+                                   keys.end(),
+                                   vals.begin(),
+                                   operators::less<key_type>{});
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    DiffType i_begin, i_end;
+    RAJA::detail::histogram::owned_runs(
+        keys.data(), n, num_chunks, chunk, i_begin, i_end);
+    RAJA::detail::histogram::reduce_runs(
+        keys.data(), vals.data(), out, i_begin, i_end);
+  });
+}
+
+} // namespace tbb
+
+} // namespace detail
+
+/*!
+        \brief add values into the bins given by indices
+*/
+template <typename ExecPolicy,
+          typename IdxIter,
+          typename ValFn,
+          typename OutIter,
+          typename DiffType>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+scatter_add(const ExecPolicy& exec,
+            IdxIter idx,
+            DiffType n,
+            ValFn val,
+            OutIter out,
+            DiffType num_bins,
+            ScatterStrategy strategy)
+{
+  using value_type = RAJA::detail::IterVal<OutIter>;
+
+  constexpr DiffType min_iterates_per_thread = static_cast<DiffType>(
+      RAJA::detail::histogram::get_min_iterates_per_thread());
+
+  const DiffType max_threads = ::tbb::this_task_arena::max_concurrency();
+  const DiffType num_threads = std::min(
+      (n + min_iterates_per_thread - 1) / min_iterates_per_thread, max_threads);
+
+  if (num_threads <= 1) {
+    RAJA::detail::histogram::scatter_range(idx, val, out, DiffType(0), n);
+    return;
+  }
+
+  switch (RAJA::detail::histogram::select_strategy<value_type>(
+              strategy, idx, n, num_bins, num_threads)) {
+    case ScatterStrategy::sort_reduce:
+      detail::tbb::scatter_sort_reduce(exec, idx, n, val, out, num_threads);
+      break;
+    case ScatterStrategy::atomic:
+      detail::tbb::scatter_atomic(idx, n, val, out);
+      break;
+    default:
+      detail::tbb::scatter_privatized(idx, n, val, out, num_bins);
+      break;
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -23,13 +23,18 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include <tbb/tbb.h>
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
 
-#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
 
 namespace RAJA
 {
@@ -40,65 +45,140 @@ namespace scan
 
 namespace detail
 {
-template <typename T, typename InIter, typename OutIter, typename Fn>
-struct scan_adapter {
-  T agg;
-  InIter const& in;
-  OutIter out;
-  Fn fn;
-  T const init;
-
-  constexpr scan_adapter(InIter const& in_,
-                         OutIter out_,
-                         Fn fn_,
-                         T const& init_)
-      : agg(init_), in(in_), out(out_), fn(fn_), init(init_)
-  {
+
+/*!
+        \brief number of blocks for a reduce-then-scan over n items, a few per
+   worker so uneven blocks balance out, and none smaller than the grain; a
+   single worker scans serially, reading the input only once
+*/
+template <typename DistanceT>
+int scan_num_blocks(DistanceT n)
+{
+  const int workers = tbb::this_task_arena::max_concurrency();
+  if (workers <= 1) {
+    return 1;
   }
-  T get_agg() const { return agg; }
+  const DistanceT grain = DistanceT(1) << 12;
+  const DistanceT max_blocks = 4 * static_cast<DistanceT>(workers);
+  return static_cast<int>(std::max(
+      DistanceT(1), std::min((n + grain - 1) / grain, max_blocks)));
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   unary function applied to each input as it is read
 
-  scan_adapter(scan_adapter& b, tbb::split)
-      : agg(Fn::identity()), in(b.in), out(b.out), fn(b.fn), init(b.init)
-  {
+   The transformed input is reduced per block, the block sums are scanned, and
+   each block is then scanned again straight into the output. The input is read
+   twice and the output written once, so the scan works in place and never
+   copies the input.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_inclusive(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename std::decay<decltype(g(*begin))>::type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int blocks = detail::scan_num_blocks(n);
+  if (blocks == 1) {
+    transform_inclusive(::RAJA::loop_exec{}, begin, end, out, f, g);
+    return;
+  }
+  ::std::vector<Value> sums(blocks, Value());
+  tbb::parallel_for(0, blocks, [&](int b) {
+    const DistanceT idx_begin = firstIndex(n, blocks, b);
+    const DistanceT idx_end = firstIndex(n, blocks, b + 1);
+    Value agg = g(begin[idx_begin]);
+    for (auto i = idx_begin + 1; i < idx_end; ++i) {
+      agg = f(agg, g(begin[i]));
+    }
+    sums[b] = agg;
+  });
+  for (int b = 1; b < blocks; ++b) {
+    sums[b] = f(sums[b - 1], sums[b]);
   }
-  void reverse_join(const scan_adapter& a) { agg = fn(agg, a.agg); }
-  void assign(const scan_adapter& b) { agg = b.agg; }
-};
-
-template <typename T, typename InIter, typename OutIter, typename Fn>
-struct scan_adapter_inclusive : scan_adapter<T, InIter, OutIter, Fn> {
-
-  using Base = scan_adapter<T, InIter, OutIter, Fn>;
-  using Base::Base;
-  template <typename Tag>
-  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
-  {
-    T temp = this->agg;
-    for (Index_type i = r.begin(); i < r.end(); ++i) {
-      temp = this->fn(temp, this->in[i]);
-      if (Tag::is_final_scan()) this->out[i] = temp;
+  tbb::parallel_for(0, blocks, [&](int b) {
+    const DistanceT idx_begin = firstIndex(n, blocks, b);
+    const DistanceT idx_end = firstIndex(n, blocks, b + 1);
+    Value agg = g(begin[idx_begin]);
+    if (b > 0) agg = f(sums[b - 1], agg);
+    out[idx_begin] = agg;
+    for (auto i = idx_begin + 1; i < idx_end; ++i) {
+      agg = f(agg, g(begin[i]));
+      out[i] = agg;
     }
-    this->agg = temp;
+  });
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function,
+   unary function applied to each input as it is read, and initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename UnaryFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_exclusive(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    UnaryFn g,
+    T v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int blocks = detail::scan_num_blocks(n);
+  if (blocks == 1) {
+    transform_exclusive(::RAJA::loop_exec{}, begin, end, out, f, g, v);
+    return;
   }
-};
-
-template <typename T, typename InIter, typename OutIter, typename Fn>
-struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
-
-  using Base = scan_adapter<T, InIter, OutIter, Fn>;
-  using Base::Base;
-  template <typename Tag>
-  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
-  {
-    if (r.begin() == 0) this->agg = this->init;
-    for (Index_type i = r.begin(); i < r.end(); ++i) {
-      auto t = this->in[i];
-      if (Tag::is_final_scan()) this->out[i] = this->agg;
-      this->agg = this->fn(this->agg, t);
+  ::std::vector<T> sums(blocks, v);
+  tbb::parallel_for(0, blocks, [&](int b) {
+    const DistanceT idx_begin = firstIndex(n, blocks, b);
+    const DistanceT idx_end = firstIndex(n, blocks, b + 1);
+    T agg = g(begin[idx_begin]);
+    for (auto i = idx_begin + 1; i < idx_end; ++i) {
+      agg = f(agg, g(begin[i]));
     }
+    sums[b] = agg;
+  });
+  T carry = v;
+  for (int b = 0; b < blocks; ++b) {
+    T s = sums[b];
+    sums[b] = carry;
+    carry = f(carry, s);
   }
-};
-}  // namespace detail
+  tbb::parallel_for(0, blocks, [&](int b) {
+    const DistanceT idx_begin = firstIndex(n, blocks, b);
+    const DistanceT idx_end = firstIndex(n, blocks, b + 1);
+    T agg = sums[b];
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      auto t = g(begin[i]);
+      out[i] = agg;
+      agg = f(agg, t);
+    }
+  });
+}
 
 /*!
         \brief explicit inclusive inplace scan given range, function, and
@@ -106,19 +186,14 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
 */
 template <typename ExecPolicy, typename Iter, typename BinFn>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
-    const ExecPolicy&,
+    const ExecPolicy& exec,
     Iter begin,
     Iter end,
     BinFn f)
 {
-  auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
-      Iter,
-      Iter,
-      BinFn>{begin, begin, f, BinFn::identity()};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_inclusive(
+      exec, begin, end, begin, f, ::RAJA::operators::identity<Value>{});
 }
 
 /*!
@@ -127,20 +202,15 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
 */
 template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
-    const ExecPolicy&,
+    const ExecPolicy& exec,
     Iter begin,
     Iter end,
     BinFn f,
     T v)
 {
-  auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
-      Iter,
-      Iter,
-      BinFn>{begin, begin, f, v};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_exclusive(
+      exec, begin, end, begin, f, ::RAJA::operators::identity<Value>{}, v);
 }
 
 /*!
@@ -149,20 +219,15 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
 */
 template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive(
-    const ExecPolicy&,
+    const ExecPolicy& exec,
     const Iter begin,
     const Iter end,
     OutIter out,
     BinFn f)
 {
-  auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
-      Iter,
-      OutIter,
-      BinFn>{begin, out, f, BinFn::identity()};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_inclusive(
+      exec, begin, end, out, f, ::RAJA::operators::identity<Value>{});
 }
 
 /*!
@@ -175,21 +240,16 @@ template <typename ExecPolicy,
           typename BinFn,
           typename T>
 concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
-    const ExecPolicy&,
+    const ExecPolicy& exec,
     const Iter begin,
     const Iter end,
     OutIter out,
     BinFn f,
     T v)
 {
-  auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
-      Iter,
-      OutIter,
-      BinFn>{begin, out, f, v};
-  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
-                                                    std::distance(begin, end)},
-                     adapter);
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  transform_exclusive(
+      exec, begin, end, out, f, ::RAJA::operators::identity<Value>{}, v);
 }
 
 }  // namespace scan
@@ -0,0 +1,339 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented reduce and scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_segmented_tbb_HPP
+#define RAJA_segmented_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/policy/loop/segmented.hpp"
+#include "RAJA/pattern/detail/segmented.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace segmented
+{
+
+namespace detail
+{
+namespace tbb
+{
+
+/*!
+        \brief parallel_scan body for a segmented scan, the running value
+               restarts at every head so joining two partial scans only
+               combines them if the right one has no head
+*/
+template <typename T, typename InIter, typename HeadFn, typename OutIter, typename Fn>
+struct segmented_scan_adapter {
+  T agg;
+  bool has_head;
+  InIter in;
+  HeadFn heads;
+  OutIter out;
+  Fn fn;
+  T const init;
+
+  segmented_scan_adapter(InIter in_,
+                         HeadFn heads_,
+                         OutIter out_,
+                         Fn fn_,
+                         T const& init_)
+      : agg(Fn::identity()),
+        has_head(false),
+        in(in_),
+        heads(heads_),
+        out(out_),
+        fn(fn_),
+        init(init_)
+  {
+  }
+
+  segmented_scan_adapter(segmented_scan_adapter& b, ::tbb::split)
+      : agg(Fn::identity()),
+        has_head(false),
+        in(b.in),
+        heads(b.heads),
+        out(b.out),
+        fn(b.fn),
+        init(b.init)
+  {
+  }
+  void reverse_join(const segmented_scan_adapter& a)
+  {
+    if (!has_head) {
+      agg = fn(a.agg, agg);
+    }
+    has_head = has_head || a.has_head;
+  }
+  void assign(const segmented_scan_adapter& b)
+  {
+    agg = b.agg;
+    has_head = b.has_head;
+  }
+};
+
+template <typename T, typename InIter, typename HeadFn, typename OutIter, typename Fn>
+struct segmented_scan_adapter_inclusive
+    : segmented_scan_adapter<T, InIter, HeadFn, OutIter, Fn> {
+
+  using Base = segmented_scan_adapter<T, InIter, HeadFn, OutIter, Fn>;
+  using Base::Base;
+  template <typename DiffType, typename Tag>
+  void operator()(const ::tbb::blocked_range<DiffType>& r, Tag)
+  {
+    T temp = this->agg;
+    for (DiffType i = r.begin(); i < r.end(); ++i) {
+      if (this->heads(i)) {
+        temp = this->in[i];
+        this->has_head = true;
+      } else {
+        temp = this->fn(temp, this->in[i]);
+      }
+      if (Tag::is_final_scan()) this->out[i] = temp;
+    }
+    this->agg = temp;
+  }
+};
+
+template <typename T, typename InIter, typename HeadFn, typename OutIter, typename Fn>
+struct segmented_scan_adapter_exclusive
+    : segmented_scan_adapter<T, InIter, HeadFn, OutIter, Fn> {
+
+  using Base = segmented_scan_adapter<T, InIter, HeadFn, OutIter, Fn>;
+  using Base::Base;
+  template <typename DiffType, typename Tag>
+  void operator()(const ::tbb::blocked_range<DiffType>& r, Tag)
+  {
+    T temp = this->agg;
+    for (DiffType i = r.begin(); i < r.end(); ++i) {
+      auto t = this->in[i];
+      if (this->heads(i)) {
+        temp = this->init;
+        this->has_head = true;
+      }
+      if (Tag::is_final_scan()) this->out[i] = temp;
+      temp = this->fn(temp, t);
+    }
+    this->agg = temp;
+  }
+};
+
+} // namespace tbb
+
+} // namespace detail
+
+/*!
+        \brief reduce each segment [offsets[s], offsets[s+1]) of vals into
+               out[s], empty segments are set to identity
+
+        Chunks split the elements evenly, so the work is balanced however
+        uneven the segments are. Segments split between chunks are
+        finished by the chunk they start in.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffIter,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+reduce(const ExecPolicy&,
+       Iter vals,
+       OffIter offsets,
+       DiffType num_segments,
+       OutIter out,
+       BinFn f,
+       T identity)
+{
+  using RAJA::detail::segmented::chunk_segments;
+  using RAJA::detail::segmented::reduce_chunk;
+  using RAJA::detail::segmented::reduce_chunk_fixup;
+
+  constexpr DiffType min_iterates_per_chunk = static_cast<DiffType>(
+      RAJA::detail::segmented::get_min_iterates_per_thread());
+
+  const DiffType n = offsets[num_segments] - offsets[0];
+  const DiffType max_chunks = ::tbb::this_task_arena::max_concurrency();
+  const DiffType num_chunks = std::min(
+      (n + min_iterates_per_chunk - 1) / min_iterates_per_chunk, max_chunks);
+
+  if (num_chunks <= 1) {
+    reduce(::RAJA::loop_exec{}, vals, offsets, num_segments, out, f, identity);
+    return;
+  }
+
+  ::std::vector<DiffType> carry_seg(num_chunks);
+  ::std::vector<T> carry(num_chunks, identity);
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    DiffType lo, hi, s_begin, s_end;
+    chunk_segments(offsets, num_segments, num_chunks, chunk,
+                   lo, hi, s_begin, s_end);
+    reduce_chunk(vals, offsets, lo, hi, s_begin, s_end, out, f, identity,
+                 carry_seg[chunk], carry[chunk]);
+  });
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    DiffType lo, hi, s_begin, s_end;
+    chunk_segments(offsets, num_segments, num_chunks, chunk,
+                   lo, hi, s_begin, s_end);
+    reduce_chunk_fixup(offsets, hi, s_begin, s_end, out, f, num_chunks, chunk,
+                       carry_seg.data(), carry.data());
+  });
+}
+
+/*!
+        \brief inclusive scan of n values that restarts at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+inclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f)
+{
+  using Value = RAJA::detail::IterVal<OutIter>;
+  auto adapter = detail::tbb::segmented_scan_adapter_inclusive<
+      Value, Iter, HeadFn, OutIter, BinFn>{in, heads, out, f, BinFn::identity()};
+  ::tbb::parallel_scan(::tbb::blocked_range<DiffType>{0, n}, adapter);
+}
+
+/*!
+        \brief exclusive scan of n values that restarts from v at every head
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename HeadFn,
+          typename OutIter,
+          typename BinFn,
+          typename T,
+          typename DiffType>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+exclusive(const ExecPolicy&,
+          Iter in,
+          DiffType n,
+          HeadFn heads,
+          OutIter out,
+          BinFn f,
+          T v)
+{
+  auto adapter = detail::tbb::segmented_scan_adapter_exclusive<
+      T, Iter, HeadFn, OutIter, BinFn>{in, heads, out, f, v};
+  ::tbb::parallel_scan(::tbb::blocked_range<DiffType>{0, n}, adapter);
+}
+
+/*!
+        \brief write the key and reduced value of each run of equal keys,
+               returns the number of runs
+
+        Chunks count the runs starting in them, then write their runs at
+        the offsets given by a scan of the counts in a single pass over the
+        keys and values. Runs split between chunks are finished by the
+        chunk they start in.
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValFn,
+          typename KeyOutIter,
+          typename ValOutIter,
+          typename BinFn,
+          typename DiffType>
+concepts::enable_if_t<DiffType, type_traits::is_tbb_policy<ExecPolicy>>
+reduce_by_key(const ExecPolicy&,
+              KeyIter keys,
+              DiffType n,
+              ValFn vals,
+              KeyOutIter keys_out,
+              ValOutIter vals_out,
+              BinFn f)
+{
+  using RAJA::detail::firstIndex;
+  using Value = RAJA::detail::IterVal<ValOutIter>;
+
+  constexpr DiffType min_iterates_per_chunk = static_cast<DiffType>(
+      RAJA::detail::segmented::get_min_iterates_per_thread());
+
+  const DiffType max_chunks = ::tbb::this_task_arena::max_concurrency();
+  const DiffType num_chunks = std::min(
+      (n + min_iterates_per_chunk - 1) / min_iterates_per_chunk, max_chunks);
+
+  if (num_chunks <= 1) {
+    return reduce_by_key(
+        ::RAJA::loop_exec{}, keys, n, vals, keys_out, vals_out, f);
+  }
+
+  const RAJA::detail::segmented::KeyHeads<KeyIter> heads{keys};
+
+  ::std::vector<DiffType> head_counts(num_chunks);
+  ::std::vector<DiffType> positions(num_chunks + 1);
+  ::std::vector<Value> carry(num_chunks);
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    head_counts[chunk] = RAJA::detail::segmented::count_heads(
+        heads, firstIndex(n, num_chunks, chunk),
+        firstIndex(n, num_chunks, chunk + 1));
+  });
+
+  positions[0] = 0;
+  for (DiffType c = 0; c < num_chunks; ++c) {
+    positions[c + 1] = positions[c] + head_counts[c];
+  }
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    RAJA::detail::segmented::reduce_by_key_chunk(
+        keys, vals, firstIndex(n, num_chunks, chunk),
+        firstIndex(n, num_chunks, chunk + 1), positions[chunk],
+        keys_out, vals_out, f, carry[chunk]);
+  });
+
+  ::tbb::parallel_for(DiffType(0), num_chunks, [&](DiffType chunk) {
+    RAJA::detail::segmented::reduce_by_key_fixup(
+        keys, n, firstIndex(n, num_chunks, chunk + 1), positions[chunk + 1],
+        vals_out, f, num_chunks, chunk, head_counts.data(), carry.data());
+  });
+
+  return positions[num_chunks];
+}
+
+}  // namespace segmented
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
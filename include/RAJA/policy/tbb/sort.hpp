@@ -21,8 +21,12 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 
 #include <tbb/tbb.h>
 
@@ -30,6 +34,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -45,90 +51,537 @@ namespace detail
 {
 
 /*!
-        \brief sort given range using sorter and comparison function
-               by spawning tasks
+        \brief whether items of type T can be radix sorted
+*/
+template <typename T>
+using is_radix_sortable = std::integral_constant<bool,
+    (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+    (std::is_floating_point<T>::value &&
+     (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)))>;
+
+/*!
+        \brief map arithmetic items to unsigned integers of the same size
+               with the same order, for radix sort
+*/
+template <typename T, typename Enable = void>
+struct RadixKey;
+///
+template <typename T>
+struct RadixKey<T, typename std::enable_if<is_radix_sortable<T>::value &&
+                                           std::is_integral<T>::value>::type>
+{
+  using type = typename std::make_unsigned<T>::type;
+
+  static RAJA_INLINE type get(T val)
+  {
+    const type sign_bit = std::is_signed<T>::value
+        ? static_cast<type>(static_cast<type>(1) << (8*sizeof(T)-1))
+        : static_cast<type>(0);
+    return static_cast<type>(static_cast<type>(val) ^ sign_bit);
+  }
+};
+///
+template <typename T>
+struct RadixKey<T, typename std::enable_if<is_radix_sortable<T>::value &&
+                                           std::is_floating_point<T>::value>::type>
+{
+  using type = typename std::conditional<sizeof(T) == sizeof(std::uint32_t),
+                                         std::uint32_t, std::uint64_t>::type;
+
+  static RAJA_INLINE type get(T val)
+  {
+    type bits;
+    memcpy(&bits, &val, sizeof(T));
+    // flip all bits of negatives and the sign bit of positives
+    const type sign_bit = static_cast<type>(1) << (8*sizeof(T)-1);
+    return bits ^ ((bits & sign_bit) ? ~static_cast<type>(0) : sign_bit);
+  }
+};
+
+/*!
+        \brief order of a radix sort equivalent to a sort of T using
+               Compare, 1 if ascending, -1 if descending, 0 if there is none
+*/
+template <typename T, typename Compare, typename Enable = void>
+struct RadixOrder : std::integral_constant<int, 0> { };
+///
+template <typename T>
+struct RadixOrder<T, RAJA::operators::less<T>, typename std::enable_if<is_radix_sortable<T>::value>::type>
+  : std::integral_constant<int, 1> { };
+///
+template <typename T>
+struct RadixOrder<T, RAJA::operators::greater<T>, typename std::enable_if<is_radix_sortable<T>::value>::type>
+  : std::integral_constant<int, -1> { };
+///
+template <typename T>
+struct RadixOrder<T, std::less<T>, typename std::enable_if<is_radix_sortable<T>::value>::type>
+  : std::integral_constant<int, 1> { };
+///
+template <typename T>
+struct RadixOrder<T, std::greater<T>, typename std::enable_if<is_radix_sortable<T>::value>::type>
+  : std::integral_constant<int, -1> { };
+
+/*!
+        \brief whether to radix sort T instead of comparison sort with
+               Sorter and Compare, the radix sort is stable but orders
+               equivalent floating point items like -0.0 and 0.0 so it is
+               only used for floating point items in unstable sorts
+*/
+template <typename Sorter, typename T, typename Compare>
+using use_radix_sort =
+    std::integral_constant<bool, RadixOrder<T, Compare>::value != 0 &&
+                                 (std::is_integral<T>::value ||
+                                  !std::is_same<Sorter, StableSorter>::value)>;
+
+/*!
+        \brief count the digits of chunk c of src for one radix sort pass
+*/
+template <typename T, int order, typename SrcIter, typename DiffType>
+inline
+void tbb_radix_count(SrcIter src,
+                     DiffType n,
+                     DiffType num_chunks,
+                     DiffType c,
+                     unsigned shift,
+                     DiffType* counts)
+{
+  using key_type = typename RadixKey<T>::type;
+
+  for (int d = 0; d < 256; ++d) {
+    counts[d] = 0;
+  }
+
+  const DiffType last = chunk_begin(n, num_chunks, c+1);
+  for (DiffType i = chunk_begin(n, num_chunks, c); i < last; ++i) {
+    key_type key = RadixKey<T>::get(src[i]);
+    if (order < 0) {
+      key = static_cast<key_type>(~key);
+    }
+    ++counts[(key >> shift) & 255u];
+  }
+}
+
+/*!
+        \brief scatter chunk c of src into dst by digit for one radix sort
+               pass, starting each digit at its offset in offsets
+*/
+template <typename T, int order, typename SrcIter, typename DstIter, typename DiffType>
+inline
+void tbb_radix_scatter(SrcIter src,
+                       DstIter dst,
+                       DiffType n,
+                       DiffType num_chunks,
+                       DiffType c,
+                       unsigned shift,
+                       DiffType* offsets)
+{
+  using key_type = typename RadixKey<T>::type;
+
+  const DiffType last = chunk_begin(n, num_chunks, c+1);
+  for (DiffType i = chunk_begin(n, num_chunks, c); i < last; ++i) {
+    key_type key = RadixKey<T>::get(src[i]);
+    if (order < 0) {
+      key = static_cast<key_type>(~key);
+    }
+    dst[offsets[(key >> shift) & 255u]++] = src[i];
+  }
+}
+
+/*!
+        \brief stable least significant digit radix sort of arithmetic
+               items in parallel, through scratch memory for n items and
+               digit counts allocated with scratch_allocator
+
+    Each pass counts the digits of chunks of the range in parallel then
+    scatters the chunks in parallel, passes where every item has the same
+    digit are skipped.
+*/
+template <int order, typename Iter, typename T, typename Allocator>
+inline
+void tbb_radix_sort(Iter begin,
+                    RAJA::detail::IterDiff<Iter> n,
+                    T* buf,
+                    Allocator const& scratch_allocator)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  // chunks smaller than this are not worth counting in parallel
+  constexpr diff_type min_chunk_size = 1 << 14;
+
+  const diff_type max_chunks = tbb::this_task_arena::max_concurrency();
+  const diff_type num_chunks = std::max(static_cast<diff_type>(1),
+                                        std::min(max_chunks, n / min_chunk_size));
+
+  RAJA::detail::SortScratch<diff_type, Allocator>
+      chunk_counts(scratch_allocator, num_chunks*256);
+  diff_type* counts = chunk_counts.data;
+
+  bool in_buf = false;
+
+  for (unsigned shift = 0; shift < 8*sizeof(T); shift += 8) {
+
+    tbb::parallel_for(static_cast<diff_type>(0), num_chunks, [&](diff_type c) {
+      if (in_buf) {
+        tbb_radix_count<T, order>(buf, n, num_chunks, c, shift, counts + c*256);
+      } else {
+        tbb_radix_count<T, order>(begin, n, num_chunks, c, shift, counts + c*256);
+      }
+    });
+
+    // find where each chunk scatters each digit,
+    // skipping the pass if every item has the same digit
+    bool skip = false;
+    diff_type offset = 0;
+    for (int d = 0; d < 256; ++d) {
+      const diff_type digit_begin = offset;
+      for (diff_type c = 0; c < num_chunks; ++c) {
+        const diff_type count = counts[c*256 + d];
+        counts[c*256 + d] = offset;
+        offset += count;
+      }
+      if (offset - digit_begin == n) {
+        skip = true;
+        break;
+      }
+    }
+    if (skip) {
+      continue;
+    }
+
+    tbb::parallel_for(static_cast<diff_type>(0), num_chunks, [&](diff_type c) {
+      if (in_buf) {
+        tbb_radix_scatter<T, order>(buf, begin, n, num_chunks, c, shift, counts + c*256);
+      } else {
+        tbb_radix_scatter<T, order>(begin, buf, n, num_chunks, c, shift, counts + c*256);
+      }
+    });
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+    tbb::parallel_for(static_cast<diff_type>(0), num_chunks, [&](diff_type c) {
+      const diff_type last = chunk_begin(n, num_chunks, c+1);
+      for (diff_type i = chunk_begin(n, num_chunks, c); i < last; ++i) {
+        begin[i] = buf[i];
+      }
+    });
+  }
+}
+
+/*!
+        \brief stable merge of the sorted ranges a and b into out by moving,
+               splitting the merge along its merge path in parallel
 */
-template < typename Sorter, typename Iter, typename Compare >
-struct TbbSortTask : tbb::task
+template <typename IterA, typename IterB, typename OutIter, typename Compare>
+inline
+void tbb_merge(IterA a,
+               RAJA::detail::IterDiff<IterA> a_len,
+               IterB b,
+               RAJA::detail::IterDiff<IterA> b_len,
+               OutIter out,
+               Compare comp)
 {
-  using diff_type =
-      camp::decay<decltype(camp::val<Iter>() - camp::val<Iter>())>;
+  using diff_type = RAJA::detail::IterDiff<IterA>;
 
-  // TODO: make this less arbitrary
-  static const diff_type cutoff = 256;
+  // merges smaller than this are not worth splitting
+  constexpr diff_type cutoff = 1 << 13;
 
-  Sorter sorter;
-  const Iter begin;
-  const Iter end;
-  Compare comp;
+  if (a_len + b_len <= cutoff) {
 
-  TbbSortTask(Sorter sorter_, Iter begin_, Iter end_, Compare comp_)
-    : sorter(sorter_)
-    , begin(begin_)
-    , end(end_)
-    , comp(comp_)
-  { }
+    RAJA::detail::merge_move(a, a + a_len, b, b + b_len, out, comp);
 
-  tbb::task* execute()
+  } else {
+
+    const diff_type diag = (a_len + b_len) / 2;
+    const diff_type a_split =
+        RAJA::detail::merge_path_split(a, a_len, b, b_len, diag, comp);
+    const diff_type b_split = diag - a_split;
+
+    tbb::parallel_invoke(
+        [&]() {
+          tbb_merge(a, a_split, b, b_split, out, comp);
+        },
+        [&]() {
+          tbb_merge(a + a_split, a_len - a_split,
+                    b + b_split, b_len - b_split,
+                    out + diag, comp);
+        });
+  }
+}
+
+/*!
+        \brief sort the leaves of tbb_merge_sort by sorting in place with
+               Sorter then moving into the unconstructed scratch memory
+*/
+template <typename Sorter>
+struct TbbSortLeaf
+{
+  template <typename Iter, typename T, typename Compare>
+  static RAJA_INLINE void sort(Iter x,
+                               T* z,
+                               RAJA::detail::IterDiff<Iter> n,
+                               Compare comp)
   {
-    diff_type len = end - begin;
+    Sorter{}(x, x + n, comp);
 
-    if (len <= cutoff) {
+    for (RAJA::detail::IterDiff<Iter> i = 0; i < n; ++i) {
+      new(&z[i]) T(std::move(x[i]));
+    }
+  }
+};
 
-      // leaves sort their range
-      sorter(begin, end, comp);
+/*!
+        \brief merge the sorted runs of width items of src into dst
+*/
+template <typename SrcIter, typename DstIter, typename DiffType, typename Compare>
+inline
+void tbb_merge_runs(SrcIter src,
+                    DstIter dst,
+                    DiffType n,
+                    DiffType width,
+                    Compare comp)
+{
+  for (DiffType first = 0; first < n; first += 2*width) {
+    const DiffType middle = std::min(first + width, n);
+    const DiffType last = std::min(first + 2*width, n);
+    RAJA::detail::merge_move(src + first, src + middle,
+                             src + middle, src + last,
+                             dst + first, comp);
+  }
+}
 
-    } else {
+/*!
+        \brief sort the leaves of tbb_merge_sort stably by moving into the
+               unconstructed scratch memory then merge sorting through it,
+               so leaves do not allocate
+*/
+template <>
+struct TbbSortLeaf<StableSorter>
+{
+  template <typename Iter, typename T, typename Compare>
+  static RAJA_INLINE void sort(Iter x,
+                               T* z,
+                               RAJA::detail::IterDiff<Iter> n,
+                               Compare comp)
+  {
+    using diff_type = RAJA::detail::IterDiff<Iter>;
 
-      Iter middle = begin + (len/2);
+    constexpr diff_type run =
+        static_cast<diff_type>(RAJA::detail::intro_sort_insertion_sort_cutoff::get());
 
-      // branching nodes break the sorting up recursively
-      TbbSortTask& sort_tank_front =
-          *new( allocate_child() ) TbbSortTask(sorter, begin, middle, comp);
-      TbbSortTask& sort_tank_back =
-          *new( allocate_child() ) TbbSortTask(sorter, middle, end, comp);
+    for (diff_type i = 0; i < n; ++i) {
+      new(&z[i]) T(std::move(x[i]));
+    }
 
-      set_ref_count(3);
-      spawn(sort_tank_back);
-      spawn_and_wait_for_all(sort_tank_front);
+    for (diff_type first = 0; first < n; first += run) {
+      RAJA::detail::insertion_sort(z + first, z + std::min(first + run, n), comp);
+    }
 
-      // and merge the results
-      RAJA::detail::inplace_merge(begin, middle, end, comp);
-      //std::inplace_merge(begin, middle, end, comp);
+    bool in_z = true;
+    for (diff_type width = run; width < n; width *= 2) {
+      if (in_z) {
+        tbb_merge_runs(z, x, n, width, comp);
+      } else {
+        tbb_merge_runs(x, z, n, width, comp);
+      }
+      in_z = !in_z;
     }
 
-    return nullptr;
+    if (!in_z) {
+      std::move(x, x + n, z);
+    }
   }
 };
 
 /*!
-        \brief sort given range using sorter and comparison function
+        \brief merge sort n items of x in parallel with tasks from
+               tbb::parallel_invoke, leaving the result in the scratch
+               memory z if to_z and in x otherwise
+
+    The recursion is levels deep, alternating where the results go, the
+    leaves are sorted with TbbSortLeaf and always go to z, which constructs
+    all the items in z before the merges move between x and z.
 */
-template <typename Sorter, typename Iter, typename Compare>
+template <typename Sorter, typename Iter, typename T, typename Compare>
+inline
+void tbb_merge_sort(Iter x,
+                    T* z,
+                    RAJA::detail::IterDiff<Iter> n,
+                    unsigned levels,
+                    bool to_z,
+                    Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  if (levels == 0) {
+
+    TbbSortLeaf<Sorter>::sort(x, z, n, comp);
+
+  } else {
+
+    const diff_type middle = n / 2;
+
+    tbb::parallel_invoke(
+        [&]() {
+          tbb_merge_sort<Sorter>(x, z, middle, levels-1, !to_z, comp);
+        },
+        [&]() {
+          tbb_merge_sort<Sorter>(x + middle, z + middle, n - middle, levels-1, !to_z, comp);
+        });
+
+    if (to_z) {
+      tbb_merge(x, middle, x + middle, n - middle, z, comp);
+    } else {
+      tbb_merge(z, middle, z + middle, n - middle, x, comp);
+    }
+  }
+}
+
+/*!
+        \brief sort given range with a comparison based parallel merge sort
+               using sorter for the leaves and scratch memory for n items
+               allocated with scratch_allocator
+*/
+template <typename Sorter, typename Iter, typename Compare, typename Allocator>
+inline
+void tbb_sort(Sorter,
+              Iter begin,
+              Iter end,
+              Compare comp,
+              Allocator const& scratch_allocator,
+              std::false_type)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  // leaves are sorted serially with at least this many items
+  constexpr diff_type cutoff = 1 << 11;
+
+  const diff_type n = end - begin;
+
+  unsigned levels = RAJA::detail::ulog2(n / cutoff);
+  // an odd number of levels leaves the leaves in the scratch memory
+  if (levels % 2 == 0) {
+    if (levels == 0) {
+      Sorter{}(begin, end, comp, scratch_allocator);
+      return;
+    }
+    --levels;
+  }
+
+  RAJA::detail::SortScratch<value_type, Allocator> scratch(scratch_allocator, n);
+
+  tbb_merge_sort<Sorter>(begin, scratch.data, n, levels, false, comp);
+
+  scratch.constructed = n;
+}
+
+/*!
+        \brief sort given range of arithmetic items with a parallel radix
+               sort using scratch memory for n items allocated with
+               scratch_allocator
+*/
+template <typename Sorter, typename Iter, typename Compare, typename Allocator>
 inline
 void tbb_sort(Sorter sorter,
               Iter begin,
               Iter end,
-              Compare comp)
+              Compare comp,
+              Allocator const& scratch_allocator,
+              std::true_type)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
-  using SortTask = TbbSortTask<Sorter, Iter, Compare>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
-  diff_type n = end - begin;
+  // ranges smaller than this are faster to sort with comparisons
+  constexpr diff_type cutoff = 1 << 12;
 
-  if (n <= SortTask::cutoff) {
+  const diff_type n = end - begin;
 
-    sorter(begin, end, comp);
+  if (n <= cutoff) {
+    tbb_sort(sorter, begin, end, comp, scratch_allocator, std::false_type{});
+    return;
+  }
 
-  } else {
+  RAJA::detail::SortScratch<value_type, Allocator> scratch(scratch_allocator, n);
 
-    SortTask& sort_task =
-        *new(tbb::task::allocate_root()) SortTask(sorter, begin, end, comp);
-    tbb::task::spawn_root_and_wait(sort_task);
+  tbb_radix_sort<RadixOrder<value_type, Compare>::value>(begin, n, scratch.data,
+                                                         scratch_allocator);
+}
 
+/*!
+        \brief sort given range using sorter and comparison function with
+               scratch memory allocated with scratch_allocator
+*/
+template <typename Sorter, typename Iter, typename Compare, typename Allocator>
+inline
+void tbb_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp,
+              Allocator const& scratch_allocator)
+{
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  if (end - begin < 2) {
+    return;
   }
+
+  tbb_sort(sorter, begin, end, comp, scratch_allocator,
+           use_radix_sort<Sorter, value_type, Compare>{});
 }
 
+/*!
+        \brief sort given range using sorter and comparison function
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+void tbb_sort(Sorter sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  tbb_sort(sorter, begin, end, comp, RAJA::detail::SortScratchAllocator<char>{});
+}
+
+/*!
+        \brief Functional that sorts in parallel with tbb_sort using Sorter
+*/
+template <typename Sorter>
+struct TbbSorter
+{
+  template < typename Iter, typename Compare >
+  RAJA_INLINE
+  void operator()(Iter begin, Iter end, Compare comp) const
+  {
+    tbb_sort(Sorter{}, begin, end, comp);
+  }
+};
+
+/*!
+        \brief Functional that runs body(i) for i in [0, n) in parallel
+*/
+struct TbbFor
+{
+  template < typename DiffType, typename Body >
+  RAJA_INLINE
+  void operator()(DiffType n, Body const& body) const
+  {
+    tbb::parallel_for(tbb::blocked_range<DiffType>(0, n),
+                      [&](tbb::blocked_range<DiffType> const& r) {
+                        for (DiffType i = r.begin(); i != r.end(); ++i) {
+                          body(i);
+                        }
+                      });
+  }
+
+  RAJA_INLINE
+  int num_chunks() const
+  {
+    return tbb::this_task_arena::max_concurrency();
+  }
+};
+
 } // namespace detail
 
 /*!
@@ -141,7 +594,7 @@ unstable(const ExecPolicy&,
          Iter end,
          Compare comp)
 {
-  tbb::parallel_sort(begin, end, comp);
+  detail::tbb_sort(detail::UnstableSorter{}, begin, end, comp);
 }
 
 /*!
@@ -157,6 +610,36 @@ stable(const ExecPolicy&,
   detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
 }
 
+/*!
+        \brief sort given range using comparison function and scratch
+               memory from the given allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+unstable(const ExecPolicy&,
+         Iter begin,
+         Iter end,
+         Compare comp,
+         Allocator const& scratch_allocator)
+{
+  detail::tbb_sort(detail::UnstableSorter{}, begin, end, comp, scratch_allocator);
+}
+
+/*!
+        \brief stable sort given range using comparison function and scratch
+               memory from the given allocator
+*/
+template <typename ExecPolicy, typename Iter, typename Compare, typename Allocator>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+stable(const ExecPolicy&,
+       Iter begin,
+       Iter end,
+       Compare comp,
+       Allocator const& scratch_allocator)
+{
+  detail::tbb_sort(detail::StableSorter{}, begin, end, comp, scratch_allocator);
+}
+
 /*!
         \brief sort given range of pairs using comparison function on keys
 */
@@ -191,6 +674,121 @@ stable_pairs(const ExecPolicy&,
   detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
 }
 
+/*!
+        \brief sort keys using comparison function and reorder each range
+               of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+unstable_by_key(const ExecPolicy&,
+                KeyIter keys_begin,
+                KeyIter keys_end,
+                Compare comp,
+                ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::TbbSorter<detail::UnstableSorter>{}, detail::TbbFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief stable sort keys using comparison function and reorder each
+               range of values with them
+*/
+template <typename ExecPolicy, typename KeyIter, typename Compare, typename... ValIters>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+stable_by_key(const ExecPolicy&,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              Compare comp,
+              ValIters... vals_begins)
+{
+  detail::sort_by_key(detail::TbbSorter<detail::StableSorter>{}, detail::TbbFor{},
+                      keys_begin, keys_end, comp, vals_begins...);
+}
+
+/*!
+        \brief partially sort given range using comparison function so
+               [begin, middle) holds its smallest items in sorted order
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+partial(const ExecPolicy&,
+        Iter begin,
+        Iter middle,
+        Iter end,
+        Compare comp)
+{
+  detail::sort_partial(detail::TbbSorter<detail::UnstableSorter>{}, detail::TbbFor{},
+                       begin, middle, end, comp);
+}
+
+/*!
+        \brief select nth item of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+nth_element(const ExecPolicy&,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp)
+{
+  detail::select_nth(detail::TbbFor{}, begin, nth, end, comp);
+}
+
+/*!
+        \brief copy k smallest items of given range in sorted order to out
+               using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+top_k(const ExecPolicy&,
+      Iter begin,
+      Iter end,
+      RAJA::detail::IterDiff<Iter> k,
+      OutIter out,
+      Compare comp)
+{
+  detail::top_k(detail::TbbSorter<detail::UnstableSorter>{}, detail::TbbFor{},
+                begin, end, k, out, comp);
+}
+
+/*!
+        \brief sort each segment of given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+unstable_segmented(const ExecPolicy&,
+                   Iter begin,
+                   OffsetIter offsets_begin,
+                   OffsetIter offsets_end,
+                   Compare comp)
+{
+  detail::segmented_sort(detail::TbbSorter<detail::UnstableSorter>{}, detail::TbbFor{},
+                         begin, offsets_begin, offsets_end, comp);
+}
+
+/*!
+        \brief sort each segment of given range of pairs using comparison
+               function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter,
+          typename OffsetIter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>>
+unstable_segmented_pairs(const ExecPolicy&,
+                         KeyIter keys_begin,
+                         ValIter vals_begin,
+                         OffsetIter offsets_begin,
+                         OffsetIter offsets_end,
+                         Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::segmented_sort(detail::TbbSorter<detail::UnstableSorter>{}, detail::TbbFor{},
+                         begin, offsets_begin, offsets_end,
+                         RAJA::compare_first<zip_ref>(comp));
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -0,0 +1,198 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for querying the CPU data cache sizes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_CacheInfo_HPP
+#define RAJA_util_CacheInfo_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#endif
+
+namespace RAJA
+{
+
+/*!
+ * Sizes in bytes of the data caches of the CPU the process runs on.
+ *
+ * Level 1 is the data cache closest to the core. Levels that could not be
+ * detected keep a typical default, so the sizes are always usable.
+ */
+struct CacheInfo {
+
+  static constexpr int max_level = 3;
+
+  size_t line_size = 64;
+  size_t size[max_level + 1] = {0, 32 * 1024, 1024 * 1024, 8 * 1024 * 1024};
+
+  //! Size of cache level, clamped to the levels that exist
+  size_t level_size(int level) const
+  {
+    return size[level < 1 ? 1 : (level > max_level ? max_level : level)];
+  }
+};
+
+namespace detail
+{
+
+#if defined(__linux__)
+
+//! Read a sysfs size such as "48K" or "2M", 0 on failure
+inline size_t read_sysfs_size(const char* path)
+{
+  size_t value = 0;
+  FILE* f = std::fopen(path, "r");
+  if (f != nullptr) {
+    unsigned long num = 0;
+    char unit = '\0';
+    int n = std::fscanf(f, "%lu%c", &num, &unit);
+    std::fclose(f);
+    if (n >= 1) {
+      value = num;
+      if (n == 2 && (unit == 'K' || unit == 'k')) value *= 1024;
+      if (n == 2 && (unit == 'M' || unit == 'm')) value *= 1024 * 1024;
+      if (n == 2 && (unit == 'G' || unit == 'g')) value *= 1024 * 1024 * 1024;
+    }
+  }
+  return value;
+}
+
+inline void query_cache_info(CacheInfo& info)
+{
+  bool found = false;
+
+  // sysfs lists every cache of cpu0, skip the instruction caches
+  for (int index = 0; index < 16; ++index) {
+    char path[128];
+    std::snprintf(path, sizeof(path),
+                  "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+    FILE* f = std::fopen(path, "r");
+    if (f == nullptr) {
+      break;
+    }
+    char type[32] = {0};
+    int n = std::fscanf(f, "%31s", type);
+    std::fclose(f);
+    if (n != 1 || std::strcmp(type, "Instruction") == 0) {
+      continue;
+    }
+
+    std::snprintf(path, sizeof(path),
+                  "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+    const size_t level = read_sysfs_size(path);
+
+    std::snprintf(path, sizeof(path),
+                  "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+    const size_t size = read_sysfs_size(path);
+
+    if (level >= 1 && level <= CacheInfo::max_level && size > 0) {
+      info.size[level] = size;
+      found = true;
+    }
+
+    std::snprintf(path,
+                  sizeof(path),
+                  "/sys/devices/system/cpu/cpu0/cache/index%d/"
+                  "coherency_line_size",
+                  index);
+    const size_t line = read_sysfs_size(path);
+    if (level == 1 && line > 0) {
+      info.line_size = line;
+    }
+  }
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  // some kernels do not expose sysfs cache entries, ask glibc instead
+  if (!found) {
+    const long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    const long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    const long line = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    if (l1 > 0) info.size[1] = static_cast<size_t>(l1);
+    if (l2 > 0) info.size[2] = static_cast<size_t>(l2);
+    if (l3 > 0) info.size[3] = static_cast<size_t>(l3);
+    if (line > 0) info.line_size = static_cast<size_t>(line);
+  }
+#endif
+}
+
+#elif defined(__APPLE__)
+
+inline void query_cache_info(CacheInfo& info)
+{
+  const char* names[CacheInfo::max_level + 1] = {
+      nullptr, "hw.l1dcachesize", "hw.l2cachesize", "hw.l3cachesize"};
+  for (int level = 1; level <= CacheInfo::max_level; ++level) {
+    int64_t value = 0;
+    size_t len = sizeof(value);
+    if (sysctlbyname(names[level], &value, &len, nullptr, 0) == 0 &&
+        value > 0) {
+      info.size[level] = static_cast<size_t>(value);
+    }
+  }
+  int64_t line = 0;
+  size_t len = sizeof(line);
+  if (sysctlbyname("hw.cachelinesize", &line, &len, nullptr, 0) == 0 &&
+      line > 0) {
+    info.line_size = static_cast<size_t>(line);
+  }
+}
+
+#else
+
+inline void query_cache_info(CacheInfo&) {}
+
+#endif
+
+//! Make levels that were not detected at least as large as the level below
+inline CacheInfo make_cache_info()
+{
+  CacheInfo info;
+  query_cache_info(info);
+  for (int level = 2; level <= CacheInfo::max_level; ++level) {
+    if (info.size[level] < info.size[level - 1]) {
+      info.size[level] = info.size[level - 1];
+    }
+  }
+  return info;
+}
+
+}  // namespace detail
+
+/*!
+ * Get the data cache sizes, queried from the operating system on first use
+ * and cached for the rest of the process.
+ */
+inline const CacheInfo& get_cache_info()
+{
+  static const CacheInfo info = detail::make_cache_info();
+  return info;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,179 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a N-dimensional index
+ *          calculator that stores data in Morton (Z-order) curve order.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_MortonLayout_HPP
+#define RAJA_util_MortonLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/SpaceFillingCurve.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * that follows the Morton (Z-order) curve.
+ *
+ * Neighbors in every dimension are close in memory, unlike the strided
+ * layouts where only the stride-one dimension is. This suits stencils and
+ * transposes that have no clear stride-one dimension, especially together
+ * with a MortonSegment over the same box, which visits the data in storage
+ * order.
+ *
+ * For example:
+ *
+ *     // 3-d layout over a 64 x 64 x 64 box
+ *     MortonLayout<3> layout(64, 64, 64);
+ *
+ *     int lin = layout(1, 2, 3);   // lin = 0b011101 = 29
+ *
+ *     int i, j, k;
+ *     layout.toIndices(lin, i, j, k); // i,j,k = {1, 2, 3}
+ *
+ * Each dimension is padded to a power of two, so the storage needed,
+ * returned by size(), is the product of the padded sizes. Indices must be
+ * non-negative.
+ */
+template <size_t NDims, typename IdxLin = Index_type>
+struct MortonLayout {
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<NDims>;
+
+  static constexpr size_t n_dims = NDims;
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  IdxLin sizes[n_dims] = {0};
+  MortonCurve<n_dims> curve;
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE MortonLayout() = default;
+  constexpr RAJA_INLINE MortonLayout(MortonLayout const &) = default;
+  constexpr RAJA_INLINE MortonLayout(MortonLayout &&) = default;
+  RAJA_INLINE MortonLayout &operator=(MortonLayout const &) = default;
+  RAJA_INLINE MortonLayout &operator=(MortonLayout &&) = default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE MortonLayout(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...}, curve(sizes)
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    const uint64_t x[n_dims] = {
+        static_cast<uint64_t>(stripIndexType(indices))...};
+    return static_cast<IdxLin>(curve.encode(x));
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    toIndicesHelper(IndexRange{},
+                    linear_index,
+                    std::forward<Indices>(indices)...);
+  }
+
+  /*!
+   * Computes the size of the linear space needed to store data in this
+   * layout, the product of the padded sizes of the dimensions.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin size() const
+  {
+    int bits = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      bits += curve.bits(d);
+    }
+    return static_cast<IdxLin>(uint64_t(1) << bits);
+  }
+
+private:
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Rest>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx, Rest... rest) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+             static_cast<int>(N),
+             static_cast<long int>(idx),
+             static_cast<long int>(sizes[N] - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+    BoundsCheck<N + 1>(rest...);
+  }
+
+  template <camp::idx_t... RangeInts, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndicesHelper(
+      camp::idx_seq<RangeInts...>,
+      IdxLin linear_index,
+      Indices &&... indices) const
+  {
+    uint64_t x[n_dims];
+    curve.decode(static_cast<uint64_t>(stripIndexType(linear_index)), x);
+    camp::sink((indices = static_cast<camp::decay<Indices>>(x[RangeInts]))...);
+  }
+};
+
+template <size_t NDims, typename IdxLin>
+constexpr size_t MortonLayout<NDims, IdxLin>::n_dims;
+template <size_t NDims, typename IdxLin>
+constexpr ptrdiff_t MortonLayout<NDims, IdxLin>::stride_one_dim;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,416 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining Morton (Z-order) and Hilbert space
+ *          filling curves over multi-dimensional index spaces.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_SpaceFillingCurve_HPP
+#define RAJA_util_SpaceFillingCurve_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "RAJA/util/macros.hpp"
+
+// BMI2 pdep/pext do the bit interleaving in one instruction each
+#if defined(__BMI2__) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+#include <immintrin.h>
+#define RAJA_SFC_USE_BMI2
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Mask of the low width bits
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t sfc_low_mask(int width)
+{
+  return width <= 0 ? uint64_t(0) : (~uint64_t(0) >> (64 - width));
+}
+
+//! Number of bits needed for the indices [0, size)
+RAJA_HOST_DEVICE RAJA_INLINE int sfc_bits_for(uint64_t size)
+{
+  int bits = 0;
+  while (bits < 64 && (uint64_t(1) << bits) < size) {
+    ++bits;
+  }
+  return bits;
+}
+
+/*!
+ * Spread the low bits of x so that consecutive bits end up stride bits
+ * apart, using shift and mask steps for strides 2 and 3.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t sfc_spread(uint64_t x, int stride)
+{
+  switch (stride) {
+    case 1:
+      return x;
+    case 2:
+      x &= 0x00000000FFFFFFFFull;
+      x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+      x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+      x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+      x = (x | (x << 2)) & 0x3333333333333333ull;
+      x = (x | (x << 1)) & 0x5555555555555555ull;
+      return x;
+    case 3:
+      x &= 0x00000000001FFFFFull;
+      x = (x | (x << 32)) & 0x001F00000000FFFFull;
+      x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+      x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+      x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+      x = (x | (x << 2)) & 0x1249249249249249ull;
+      return x;
+    default: {
+      uint64_t r = 0;
+      for (int b = 0; b * stride < 64; ++b) {
+        r |= ((x >> b) & uint64_t(1)) << (b * stride);
+      }
+      return r;
+    }
+  }
+}
+
+//! Inverse of sfc_spread, gather every stride-th bit of x
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t sfc_compact(uint64_t x, int stride)
+{
+  switch (stride) {
+    case 1:
+      return x;
+    case 2:
+      x &= 0x5555555555555555ull;
+      x = (x | (x >> 1)) & 0x3333333333333333ull;
+      x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+      x = (x | (x >> 4)) & 0x00FF00FF00FF00FFull;
+      x = (x | (x >> 8)) & 0x0000FFFF0000FFFFull;
+      x = (x | (x >> 16)) & 0x00000000FFFFFFFFull;
+      return x;
+    case 3:
+      x &= 0x1249249249249249ull;
+      x = (x | (x >> 2)) & 0x10C30C30C30C30C3ull;
+      x = (x | (x >> 4)) & 0x100F00F00F00F00Full;
+      x = (x | (x >> 8)) & 0x001F0000FF0000FFull;
+      x = (x | (x >> 16)) & 0x001F00000000FFFFull;
+      x = (x | (x >> 32)) & 0x00000000001FFFFFull;
+      return x;
+    default: {
+      uint64_t r = 0;
+      for (int b = 0; b * stride < 64; ++b) {
+        r |= ((x >> (b * stride)) & uint64_t(1)) << b;
+      }
+      return r;
+    }
+  }
+}
+
+/*!
+ * Masks that move the bits of a fixed mask to the low bits in six shift
+ * steps, for the parallel compress and expand of Hacker's Delight 7-4 and
+ * 7-5, used when pext and pdep are not available.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE void sfc_move_masks(uint64_t m, uint64_t (&mv)[6])
+{
+  uint64_t mk = ~m << 1;
+  for (int i = 0; i < 6; ++i) {
+    uint64_t mp = mk ^ (mk << 1);
+    mp ^= mp << 2;
+    mp ^= mp << 4;
+    mp ^= mp << 8;
+    mp ^= mp << 16;
+    mp ^= mp << 32;
+    mv[i] = mp & m;
+    m = (m ^ mv[i]) | (mv[i] >> (1 << i));
+    mk &= ~mp;
+  }
+}
+
+//! Gather the bits of x selected by m into the low bits, like pext
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t sfc_extract(uint64_t x,
+                                                  uint64_t m,
+                                                  const uint64_t (&mv)[6])
+{
+#if defined(RAJA_SFC_USE_BMI2)
+  RAJA_UNUSED_VAR(mv);
+  return _pext_u64(x, m);
+#else
+  x &= m;
+  for (int i = 0; i < 6; ++i) {
+    const uint64_t t = x & mv[i];
+    x = (x ^ t) | (t >> (1 << i));
+  }
+  return x;
+#endif
+}
+
+//! Scatter the low bits of x to the bits selected by m, like pdep
+RAJA_HOST_DEVICE RAJA_INLINE uint64_t sfc_deposit(uint64_t x,
+                                                  uint64_t m,
+                                                  const uint64_t (&mv)[6])
+{
+#if defined(RAJA_SFC_USE_BMI2)
+  RAJA_UNUSED_VAR(mv);
+  return _pdep_u64(x, m);
+#else
+  for (int i = 5; i >= 0; --i) {
+    const uint64_t t = x << (1 << i);
+    x = (x & ~mv[i]) | (t & mv[i]);
+  }
+  return x & m;
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * Morton (Z-order) curve over an n_dims dimensional box.
+ *
+ * Each dimension is padded to a power of two, and the curve index is made
+ * by interleaving the bits of the indices, the last dimension in the lowest
+ * bit of each group. Dimensions with fewer bits drop out of the
+ * interleaving once their bits are used up, so boxes that are not cubes
+ * are not padded to a cube. The total number of bits must be at most 64.
+ *
+ * With BMI2 the interleaving is one pdep or pext per dimension, otherwise
+ * it is six branch-free shift and mask steps per dimension.
+ */
+template <size_t n_dims>
+class MortonCurve
+{
+  static_assert(n_dims >= 1 && n_dims <= 64,
+                "MortonCurve supports 1 to 64 dimensions");
+
+public:
+  static constexpr size_t num_dims = n_dims;
+
+  RAJA_HOST_DEVICE RAJA_INLINE MortonCurve() {}
+
+  //! Curve over the box [0, sizes[0]) x ... x [0, sizes[n_dims-1])
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE explicit MortonCurve(
+      const IdxT (&sizes)[n_dims])
+  {
+    int total = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      m_bits[d] = detail::sfc_bits_for(
+          sizes[d] > IdxT(0) ? static_cast<uint64_t>(sizes[d]) : uint64_t(1));
+      total += m_bits[d];
+    }
+    if (total > 64) {
+      RAJA_ABORT_OR_THROW("MortonCurve index space exceeds 64 bits");
+    }
+
+    // bit positions of each dimension, level by level
+    int pos = 0;
+    for (int level = 0; pos < total; ++level) {
+      for (size_t d = n_dims; d-- > 0;) {
+        if (level < m_bits[d]) {
+          m_masks[d] |= uint64_t(1) << pos;
+          ++pos;
+        }
+      }
+    }
+
+    for (size_t d = 0; d < n_dims; ++d) {
+      detail::sfc_move_masks(m_masks[d], m_moves[d]);
+    }
+  }
+
+  //! Curve index of the point x
+  RAJA_HOST_DEVICE RAJA_INLINE uint64_t encode(const uint64_t (&x)[n_dims]) const
+  {
+    uint64_t code = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      code |= detail::sfc_deposit(x[d], m_masks[d], m_moves[d]);
+    }
+    return code;
+  }
+
+  //! Point x at curve index code
+  RAJA_HOST_DEVICE RAJA_INLINE void decode(uint64_t code,
+                                           uint64_t (&x)[n_dims]) const
+  {
+    for (size_t d = 0; d < n_dims; ++d) {
+      x[d] = detail::sfc_extract(code, m_masks[d], m_moves[d]);
+    }
+  }
+
+  //! Number of bits of dimension d, the padded size is 2^bits(d)
+  RAJA_HOST_DEVICE RAJA_INLINE int bits(size_t d) const { return m_bits[d]; }
+
+  //! Bit positions of dimension d in the curve index
+  RAJA_HOST_DEVICE RAJA_INLINE uint64_t mask(size_t d) const
+  {
+    return m_masks[d];
+  }
+
+private:
+  int m_bits[n_dims] = {0};
+  uint64_t m_masks[n_dims] = {0};
+  uint64_t m_moves[n_dims][6] = {};
+};
+
+template <size_t n_dims>
+constexpr size_t MortonCurve<n_dims>::num_dims;
+
+/*!
+ * Hilbert curve over an n_dims dimensional box, padded to a cube with a
+ * power of two edge.
+ *
+ * Unlike the Morton curve, consecutive points of the Hilbert curve are
+ * always neighbors. The curve index is computed with Skilling's transform
+ * ("Programming the Hilbert curve", AIP Conf. Proc. 707, 2004), whose bit
+ * interleaving step is shared with the Morton curve.
+ */
+template <size_t n_dims>
+class HilbertCurve
+{
+  static_assert(n_dims >= 1 && n_dims <= 64,
+                "HilbertCurve supports 1 to 64 dimensions");
+
+public:
+  static constexpr size_t num_dims = n_dims;
+
+  RAJA_HOST_DEVICE RAJA_INLINE HilbertCurve() {}
+
+  //! Curve over the smallest cube containing [0, sizes[0]) x ...
+  template <typename IdxT>
+  RAJA_HOST_DEVICE RAJA_INLINE explicit HilbertCurve(
+      const IdxT (&sizes)[n_dims])
+  {
+    for (size_t d = 0; d < n_dims; ++d) {
+      const int b = detail::sfc_bits_for(
+          sizes[d] > IdxT(0) ? static_cast<uint64_t>(sizes[d]) : uint64_t(1));
+      m_bits = b > m_bits ? b : m_bits;
+    }
+    if (m_bits * static_cast<int>(n_dims) > 64) {
+      RAJA_ABORT_OR_THROW("HilbertCurve index space exceeds 64 bits");
+    }
+  }
+
+  //! Curve index of the point x
+  RAJA_HOST_DEVICE RAJA_INLINE uint64_t encode(const uint64_t (&x)[n_dims]) const
+  {
+    uint64_t t[n_dims];
+    for (size_t d = 0; d < n_dims; ++d) {
+      t[d] = x[d];
+    }
+    axes_to_transpose(t);
+
+    uint64_t code = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      code |= detail::sfc_spread(t[d], static_cast<int>(n_dims))
+              << (n_dims - 1 - d);
+    }
+    return code;
+  }
+
+  //! Point x at curve index code
+  RAJA_HOST_DEVICE RAJA_INLINE void decode(uint64_t code,
+                                           uint64_t (&x)[n_dims]) const
+  {
+    for (size_t d = 0; d < n_dims; ++d) {
+      x[d] = detail::sfc_compact(code >> (n_dims - 1 - d),
+                                 static_cast<int>(n_dims));
+    }
+    transpose_to_axes(x);
+  }
+
+  //! Number of bits of dimension d, the padded size is 2^bits(d)
+  RAJA_HOST_DEVICE RAJA_INLINE int bits(size_t) const { return m_bits; }
+
+private:
+  RAJA_HOST_DEVICE RAJA_INLINE void axes_to_transpose(
+      uint64_t (&x)[n_dims]) const
+  {
+    if (m_bits == 0) {
+      return;
+    }
+    const uint64_t m = uint64_t(1) << (m_bits - 1);
+
+    // inverse undo
+    for (uint64_t q = m; q > 1; q >>= 1) {
+      const uint64_t p = q - 1;
+      for (size_t d = 0; d < n_dims; ++d) {
+        if (x[d] & q) {
+          x[0] ^= p;
+        } else {
+          const uint64_t t = (x[0] ^ x[d]) & p;
+          x[0] ^= t;
+          x[d] ^= t;
+        }
+      }
+    }
+
+    // gray encode
+    for (size_t d = 1; d < n_dims; ++d) {
+      x[d] ^= x[d - 1];
+    }
+    uint64_t t = 0;
+    for (uint64_t q = m; q > 1; q >>= 1) {
+      if (x[n_dims - 1] & q) {
+        t ^= q - 1;
+      }
+    }
+    for (size_t d = 0; d < n_dims; ++d) {
+      x[d] ^= t;
+    }
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void transpose_to_axes(
+      uint64_t (&x)[n_dims]) const
+  {
+    if (m_bits == 0) {
+      return;
+    }
+    const uint64_t n = uint64_t(2) << (m_bits - 1);
+
+    // gray decode
+    const uint64_t t = x[n_dims - 1] >> 1;
+    for (size_t d = n_dims - 1; d > 0; --d) {
+      x[d] ^= x[d - 1];
+    }
+    x[0] ^= t;
+
+    // undo excess work
+    for (uint64_t q = 2; q != n; q <<= 1) {
+      const uint64_t p = q - 1;
+      for (size_t d = n_dims; d-- > 0;) {
+        if (x[d] & q) {
+          x[0] ^= p;
+        } else {
+          const uint64_t s = (x[0] ^ x[d]) & p;
+          x[0] ^= s;
+          x[d] ^= s;
+        }
+      }
+    }
+  }
+
+  int m_bits = 0;
+};
+
+template <size_t n_dims>
+constexpr size_t HilbertCurve<n_dims>::num_dims;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
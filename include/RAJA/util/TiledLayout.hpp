@@ -0,0 +1,235 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator that stores data in blocks of fixed size.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_TiledLayout_HPP
+#define RAJA_util_TiledLayout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Range, typename TileSizes, typename IdxLin = Index_type>
+struct TiledLayout_impl;
+
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+struct TiledLayout_impl<camp::idx_seq<RangeInts...>,
+                        camp::idx_seq<TileSizes...>,
+                        IdxLin> {
+  static_assert(sizeof...(RangeInts) == sizeof...(TileSizes),
+                "one tile size per dimension is needed");
+
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+  using UIdxLin = typename std::make_unsigned<IdxLin>::type;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  //! number of elements in one tile
+  static constexpr IdxLin tile_volume = product<IdxLin>(IdxLin(TileSizes)...);
+
+  IdxLin sizes[n_dims] = {0};
+  IdxLin num_tiles[n_dims] = {0};
+  IdxLin tile_strides[n_dims] = {0};
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE TiledLayout_impl() = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl const &) = default;
+  constexpr RAJA_INLINE TiledLayout_impl(TiledLayout_impl &&) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl const &) = default;
+  RAJA_INLINE TiledLayout_impl &operator=(TiledLayout_impl &&) = default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        num_tiles{((sizes[RangeInts] + IdxLin(TileSizes) - 1) /
+                   IdxLin(TileSizes))...},
+        tile_strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+            tile_volume, num_tiles))...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   *
+   * The tile of each index and the position inside the tile are a division
+   * and remainder by a compile time constant, a shift and a mask for power
+   * of two tile sizes, so there are no branches.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin operator()(
+      Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    return sum<IdxLin>(
+        (static_cast<IdxLin>(static_cast<UIdxLin>(stripIndexType(indices)) /
+                             UIdxLin(TileSizes)) *
+         tile_strides[RangeInts])...,
+        (static_cast<IdxLin>(static_cast<UIdxLin>(stripIndexType(indices)) %
+                             UIdxLin(TileSizes)) *
+         intra_tile_stride(RangeInts))...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    const IdxLin intra = linear_index % tile_volume;
+    camp::sink((indices = static_cast<camp::decay<Indices>>(
+                    (linear_index / tile_strides[RangeInts]) %
+                        (num_tiles[RangeInts] ? num_tiles[RangeInts]
+                                              : IdxLin(1)) *
+                        IdxLin(TileSizes) +
+                    (intra / intra_tile_stride(RangeInts)) %
+                        IdxLin(TileSizes)))...);
+  }
+
+  /*!
+   * Computes the size of the linear space needed to store data in this
+   * layout, the sizes of the dimensions rounded up to whole tiles.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return product<IdxLin>(
+        tile_volume,
+        (num_tiles[RangeInts] ? num_tiles[RangeInts] : IdxLin(1))...);
+  }
+
+  //! Stride of dimension dim inside a tile
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr IdxLin intra_tile_stride(
+      camp::idx_t dim)
+  {
+    return product<IdxLin>(
+        IdxLin(1), (RangeInts > dim ? IdxLin(TileSizes) : IdxLin(1))...);
+  }
+
+private:
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Rest>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx, Rest... rest) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+             static_cast<int>(N),
+             static_cast<long int>(idx),
+             static_cast<long int>(sizes[N] - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+    BoundsCheck<N + 1>(rest...);
+  }
+};
+
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+constexpr size_t TiledLayout_impl<camp::idx_seq<RangeInts...>,
+                                  camp::idx_seq<TileSizes...>,
+                                  IdxLin>::n_dims;
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+constexpr ptrdiff_t TiledLayout_impl<camp::idx_seq<RangeInts...>,
+                                     camp::idx_seq<TileSizes...>,
+                                     IdxLin>::stride_one_dim;
+template <camp::idx_t... RangeInts, camp::idx_t... TileSizes, typename IdxLin>
+constexpr IdxLin TiledLayout_impl<camp::idx_seq<RangeInts...>,
+                                  camp::idx_seq<TileSizes...>,
+                                  IdxLin>::tile_volume;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space
+ * that stores the data in tiles of TileSizes... elements.
+ *
+ * The tiles are stored one after the other in row-major order, and the
+ * elements of each tile are stored contiguously, also in row-major order.
+ * A tile of a 3D stencil or of a transpose is then a few contiguous cache
+ * lines, however the loops are ordered, which permuting strides alone
+ * cannot give.
+ *
+ * For example:
+ *
+ *     // 100 x 100 matrix stored in 8 x 8 tiles
+ *     TiledLayout<8, 8> layout(100, 100);
+ *
+ *     int lin = layout(9, 2);   // tile (1, 0), element (1, 2) of the tile
+ *                               // lin = 13 * 64 + 1 * 8 + 2 = 842
+ *
+ *     int i, j;
+ *     layout.toIndices(lin, i, j); // i,j = {9, 2}
+ *
+ * The sizes are rounded up to whole tiles, so the storage needed, returned
+ * by size(), is 104 * 104 in the example. Power of two tile sizes make the
+ * index arithmetic shifts and masks. Indices must be non-negative.
+ */
+template <camp::idx_t... TileSizes>
+using TiledLayout =
+    detail::TiledLayout_impl<camp::make_idx_seq_t<sizeof...(TileSizes)>,
+                             camp::idx_seq<TileSizes...>,
+                             Index_type>;
+
+/*!
+ * TiledLayout with linear index type IdxLin.
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+using TiledLayoutT =
+    detail::TiledLayout_impl<camp::make_idx_seq_t<sizeof...(TileSizes)>,
+                             camp::idx_seq<TileSizes...>,
+                             strip_index_type_t<IdxLin>>;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,240 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining ViewCursor, an incrementally updated
+ *          accessor for a View inside RAJA::kernel loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ViewCursor_HPP
+#define RAJA_util_ViewCursor_HPP
+
+#include <type_traits>
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/View.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Index of dimension Dim that maps to linear index 0, the lower bound for
+ * layouts with offsets and 0 otherwise.
+ */
+template <camp::idx_t Dim, typename IdxLin, typename Layout>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr auto view_cursor_origin(
+    Layout const &layout,
+    int) -> decltype(static_cast<IdxLin>(layout.offsets[Dim]))
+{
+  return static_cast<IdxLin>(layout.offsets[Dim]);
+}
+
+template <camp::idx_t Dim, typename IdxLin, typename Layout>
+RAJA_HOST_DEVICE RAJA_INLINE constexpr IdxLin view_cursor_origin(Layout const &,
+                                                                 long)
+{
+  return IdxLin(0);
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Accessor for a View that follows the loops of a RAJA::kernel.
+ *
+ * Dimension d of the view follows kernel argument ArgIds[d]. The cursor
+ * keeps the linear index of the current element, and each time a loop
+ * assigns one of those arguments only the change in that dimension is added,
+ * a multiply and an add, instead of the whole layout computation for every
+ * access. The lambda then reads the current element with no index
+ * arithmetic, and its neighbors with one multiply-add per non-zero offset.
+ *
+ * Cursors are passed to RAJA::kernel_param as parameters, and need a view
+ * whose layout has constant strides, like Layout, OffsetLayout, their typed
+ * variants and StaticLayout. For example:
+ *
+ *     RAJA::View<double, RAJA::Layout<3>> A(a, N, N, N);
+ *     RAJA::View<double, RAJA::Layout<3>> B(b, N, N, N);
+ *
+ *     RAJA::kernel_param<Pol>(
+ *       RAJA::make_tuple(RangeSegment(1, N-1), RangeSegment(1, N-1),
+ *                        RangeSegment(1, N-1)),
+ *       RAJA::make_tuple(RAJA::make_view_cursor<0, 1, 2>(A),
+ *                        RAJA::make_view_cursor<0, 1, 2>(B)),
+ *       [=](Index_type, Index_type, Index_type, auto &a, auto &b) {
+ *         b() = a(-1, 0, 0) + a(1, 0, 0) + a(0, 0, -1) + a(0, 0, 1);
+ *       });
+ *
+ * The cursor is moved by the loops that assign its arguments, so all of
+ * them must be assigned by enclosing loops before it is used.
+ */
+template <typename ViewType, camp::idx_t... ArgIds>
+class ViewCursor
+{
+public:
+  using view_type = ViewType;
+  using value_type = typename view_type::value_type;
+  using pointer_type = typename view_type::pointer_type;
+  using layout_type = typename view_type::layout_type;
+  using linear_index_type =
+      strip_index_type_t<typename view_type::linear_index_type>;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(ArgIds)>;
+
+  static constexpr size_t n_dims = sizeof...(ArgIds);
+
+  static_assert(n_dims == layout_type::n_dims,
+                "one kernel argument per view dimension is needed");
+
+  RAJA_HOST_DEVICE RAJA_INLINE explicit ViewCursor(view_type const &view)
+      : ViewCursor(view, IndexRange{})
+  {
+  }
+
+  RAJA_INLINE constexpr ViewCursor(ViewCursor const &) = default;
+  RAJA_INLINE constexpr ViewCursor(ViewCursor &&) = default;
+  RAJA_INLINE ViewCursor &operator=(ViewCursor const &) = default;
+  RAJA_INLINE ViewCursor &operator=(ViewCursor &&) = default;
+
+  /*!
+   * Element at the current indices.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()() const
+  {
+    return m_data[m_offset];
+  }
+
+  /*!
+   * Element at the current indices plus deltas..., one per dimension.
+   */
+  template <typename... Deltas>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Deltas... deltas) const
+  {
+    static_assert(sizeof...(Deltas) == n_dims,
+                  "number of dimensions must match");
+    return at(IndexRange{}, deltas...);
+  }
+
+  /*!
+   * Linear index of the current element.
+   */
+  RAJA_HOST_DEVICE RAJA_INLINE linear_index_type get_offset() const
+  {
+    return m_offset;
+  }
+
+  /*!
+   * Called by RAJA::kernel when a loop assigns offset i of segment to
+   * argument ArgId; does nothing if no dimension follows ArgId.
+   */
+  template <camp::idx_t ArgId, typename Segment, typename Offset>
+  RAJA_HOST_DEVICE RAJA_INLINE void assign_offset(Segment const &segment,
+                                                  Offset const &i)
+  {
+    assign_offset_expanded<ArgId>(
+        std::integral_constant<bool, follows<ArgId>()>{}, segment, i);
+  }
+
+private:
+  template <camp::idx_t... Dims>
+  RAJA_HOST_DEVICE RAJA_INLINE ViewCursor(view_type const &view,
+                                          camp::idx_seq<Dims...> const &)
+      : m_data(view.get_data()),
+        m_strides{static_cast<linear_index_type>(stripIndexType(
+            view.get_layout().template get_dim_stride<Dims>()))...},
+        m_index{detail::view_cursor_origin<Dims, linear_index_type>(
+            view.get_layout(), 0)...},
+        m_offset(0)
+  {
+  }
+
+  template <camp::idx_t ArgId>
+  RAJA_HOST_DEVICE RAJA_INLINE static constexpr bool follows()
+  {
+    return foldl(RAJA::operators::bit_or<bool>(), (ArgIds == ArgId)...);
+  }
+
+  template <camp::idx_t ArgId, typename Segment, typename Offset>
+  RAJA_HOST_DEVICE RAJA_INLINE void assign_offset_expanded(
+      std::false_type,
+      Segment const &,
+      Offset const &)
+  {
+  }
+
+  template <camp::idx_t ArgId, typename Segment, typename Offset>
+  RAJA_HOST_DEVICE RAJA_INLINE void assign_offset_expanded(
+      std::true_type,
+      Segment const &segment,
+      Offset const &i)
+  {
+    move<ArgId>(static_cast<linear_index_type>(
+                    stripIndexType(segment.begin()[i])),
+                IndexRange{});
+  }
+
+  template <camp::idx_t ArgId, camp::idx_t... Dims>
+  RAJA_HOST_DEVICE RAJA_INLINE void move(linear_index_type value,
+                                         camp::idx_seq<Dims...> const &)
+  {
+    camp::sink((ArgIds == ArgId ? move_dim<Dims>(value) : 0)...);
+  }
+
+  template <camp::idx_t Dim>
+  RAJA_HOST_DEVICE RAJA_INLINE int move_dim(linear_index_type value)
+  {
+    m_offset += m_strides[Dim] * (value - m_index[Dim]);
+    m_index[Dim] = value;
+    return 0;
+  }
+
+  template <camp::idx_t... Dims, typename... Deltas>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &at(camp::idx_seq<Dims...> const &,
+                                              Deltas... deltas) const
+  {
+    return m_data[m_offset +
+                  sum<linear_index_type>(
+                      m_strides[Dims] *
+                      static_cast<linear_index_type>(
+                          stripIndexType(deltas))...)];
+  }
+
+  pointer_type m_data;
+  linear_index_type m_strides[n_dims];
+  linear_index_type m_index[n_dims];
+  linear_index_type m_offset;
+};
+
+/*!
+ * Makes a ViewCursor whose dimension d follows kernel argument ArgIds[d].
+ */
+template <camp::idx_t... ArgIds, typename ViewType>
+RAJA_HOST_DEVICE RAJA_INLINE ViewCursor<ViewType, ArgIds...> make_view_cursor(
+    ViewType const &view)
+{
+  return ViewCursor<ViewType, ArgIds...>(view);
+}
+
+}  // namespace RAJA
+
+#endif
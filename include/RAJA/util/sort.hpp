@@ -20,8 +20,10 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -29,6 +31,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 namespace RAJA
 {
 
@@ -139,6 +143,162 @@ insertion_sort(Iter begin,
   }
 }
 
+/*!
+    \brief get comparator c of Batcher's merge exchange sorting network for n
+    items (Knuth, Algorithm 5.2.2M), the higher index if hi and the lower
+    index otherwise, or get the number of comparators if there is no
+    comparator c
+*/
+RAJA_HOST_DEVICE RAJA_INLINE
+constexpr int odd_even_merge_network_comparator(int n, int c, bool hi)
+{
+  int count = 0;
+  int t = 0;
+  while ((1 << t) < n) {
+    ++t;
+  }
+  for (int p = (t > 0) ? (1 << (t-1)) : 0; p > 0; p /= 2) {
+    int q = 1 << (t-1);
+    int r = 0;
+    int d = p;
+    for (;;) {
+      for (int i = 0; i + d < n; ++i) {
+        if ((i & p) == r) {
+          if (count == c) {
+            return hi ? i+d : i;
+          }
+          ++count;
+        }
+      }
+      if (q == p) {
+        break;
+      }
+      d = q - p;
+      q /= 2;
+      r = p;
+    }
+  }
+  return count;
+}
+
+/*!
+    \brief apply comparators [C, Size) of the sorting network for N items
+    to an array of items using comparison function,
+    the indices are constant so the items can stay in registers
+*/
+template <int N, int C,
+          int Size = odd_even_merge_network_comparator(N, -1, false)>
+struct odd_even_merge_network
+{
+  template <typename T, typename Compare>
+  RAJA_HOST_DEVICE RAJA_INLINE
+  static void apply(T* v, Compare comp)
+  {
+    constexpr int lo = odd_even_merge_network_comparator(N, C, false);
+    constexpr int hi = odd_even_merge_network_comparator(N, C, true);
+
+    // select instead of branching on the comparison
+    const T x = v[lo];
+    const T y = v[hi];
+    const bool swap = comp(y, x);
+    v[lo] = swap ? y : x;
+    v[hi] = swap ? x : y;
+
+    odd_even_merge_network<N, C+1, Size>::apply(v, comp);
+  }
+};
+///
+template <int N, int Size>
+struct odd_even_merge_network<N, Size, Size>
+{
+  template <typename T, typename Compare>
+  RAJA_HOST_DEVICE RAJA_INLINE
+  static void apply(T*, Compare)
+  {
+  }
+};
+
+/*!
+    \brief unstable sorting network sort of N items inplace using comparison
+    function and using O(N*lg(N)^2) comparisons and O(N) memory
+*/
+template <int N, typename Iter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+void
+network_sort(Iter begin,
+             Compare comp)
+{
+  using value_type = ::RAJA::detail::IterVal<Iter>;
+
+  value_type v[N];
+  for (int i = 0; i < N; ++i) {
+    v[i] = begin[i];
+  }
+
+  odd_even_merge_network<N, 0>::apply(v, comp);
+
+  for (int i = 0; i < N; ++i) {
+    begin[i] = v[i];
+  }
+}
+
+/*!
+    \brief unstable sort of a small given range inplace using comparison
+    function, with a sorting network for up to 16 arithmetic items
+    and insertion sort otherwise
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+void
+small_sort(Iter begin,
+           Iter end,
+           Compare comp,
+           std::true_type)
+{
+  switch (end - begin) {
+    case 0:
+    case 1:  break;
+    case 2:  detail::network_sort<2>(begin, comp); break;
+    case 3:  detail::network_sort<3>(begin, comp); break;
+    case 4:  detail::network_sort<4>(begin, comp); break;
+    case 5:  detail::network_sort<5>(begin, comp); break;
+    case 6:  detail::network_sort<6>(begin, comp); break;
+    case 7:  detail::network_sort<7>(begin, comp); break;
+    case 8:  detail::network_sort<8>(begin, comp); break;
+    case 9:  detail::network_sort<9>(begin, comp); break;
+    case 10: detail::network_sort<10>(begin, comp); break;
+    case 11: detail::network_sort<11>(begin, comp); break;
+    case 12: detail::network_sort<12>(begin, comp); break;
+    case 13: detail::network_sort<13>(begin, comp); break;
+    case 14: detail::network_sort<14>(begin, comp); break;
+    case 15: detail::network_sort<15>(begin, comp); break;
+    case 16: detail::network_sort<16>(begin, comp); break;
+    default: detail::insertion_sort(begin, end, comp); break;
+  }
+}
+///
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+void
+small_sort(Iter begin,
+           Iter end,
+           Compare comp,
+           std::false_type)
+{
+  detail::insertion_sort(begin, end, comp);
+}
+///
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE RAJA_INLINE
+void
+small_sort(Iter begin,
+           Iter end,
+           Compare comp)
+{
+  detail::small_sort(begin, end, comp,
+                     std::is_arithmetic<::RAJA::detail::IterVal<Iter>>{});
+}
+
 /*!
     \brief get number of strides for shell sort
 */
@@ -282,22 +442,20 @@ heapify(Iter begin,
 }
 
 /*!
-    \brief unstable heap sort given range inplace using comparison function
-    and using O(N*lg(N)) comparisons and O(1) memory
+    \brief make given range into a max heap inplace using comparison function
+    and using O(N) comparisons and O(1) memory
 */
 template <typename Iter, typename Compare>
 RAJA_HOST_DEVICE inline
 void
-heap_sort(Iter begin,
+make_heap(Iter begin,
           Iter end,
           Compare comp)
 {
-  using RAJA::safe_iter_swap;
-
   auto N = end - begin;
 
   if (N < 2) {
-    // already sorted
+    // already a heap
     return;
   }
 
@@ -309,6 +467,24 @@ heap_sort(Iter begin,
   }
   // finish heapifying
   heapify(begin, begin, end, comp);
+}
+
+/*!
+    \brief sort given max heap inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+sort_heap(Iter begin,
+          Iter end,
+          Compare comp)
+{
+  using RAJA::safe_iter_swap;
+
+  if (begin == end) {
+    return;
+  }
 
   // remove one element from max heap repeatedly until sorted
   for (--end; begin != end; --end) {
@@ -321,6 +497,98 @@ heap_sort(Iter begin,
   }
 }
 
+/*!
+    \brief unstable heap sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+heap_sort(Iter begin,
+          Iter end,
+          Compare comp)
+{
+  detail::make_heap(begin, end, comp);
+  detail::sort_heap(begin, end, comp);
+}
+
+/*!
+    \brief unstable partial sort given range inplace using comparison function
+    so [begin, middle) holds the smallest items of the range in sorted order,
+    using O(N*lg(middle-begin)) comparisons and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+heap_select(Iter begin,
+            Iter middle,
+            Iter end,
+            Compare comp)
+{
+  using RAJA::safe_iter_swap;
+
+  if (begin == middle) {
+    return;
+  }
+
+  // keep the smallest items seen so far in a max heap in [begin, middle)
+  detail::make_heap(begin, middle, comp);
+
+  for (Iter next = middle; next != end; ++next) {
+
+    // replace the largest kept item if next is smaller
+    if (comp(*next, *begin)) {
+      safe_iter_swap(begin, next);
+      heapify(begin, begin, middle, comp);
+    }
+  }
+
+  detail::sort_heap(begin, middle, comp);
+}
+
+/*!
+    \brief copy the smallest items of the given range into the output range
+    in sorted order using comparison function, the output range holds
+    min(end-begin, out_end-out_begin) items and must already be constructed,
+    using O(N*lg(out_end-out_begin)) comparisons and O(1) memory
+    returns the end of the written output
+*/
+template <typename Iter, typename OutIter, typename Compare>
+RAJA_HOST_DEVICE inline
+OutIter
+heap_select_copy(Iter begin,
+                 Iter end,
+                 OutIter out_begin,
+                 OutIter out_end,
+                 Compare comp)
+{
+  // fill the output with the first items
+  OutIter out_last = out_begin;
+  for (; begin != end && out_last != out_end; ++begin, ++out_last) {
+    *out_last = *begin;
+  }
+
+  if (out_last == out_begin) {
+    return out_last;
+  }
+
+  // keep the smallest items seen so far in a max heap in the output
+  detail::make_heap(out_begin, out_last, comp);
+
+  for (; begin != end; ++begin) {
+
+    // replace the largest kept item if begin is smaller
+    if (comp(*begin, *out_begin)) {
+      *out_begin = *begin;
+      heapify(out_begin, out_begin, out_last, comp);
+    }
+  }
+
+  detail::sort_heap(out_begin, out_last, comp);
+
+  return out_last;
+}
+
 /*!
     \brief max recursion depth for intro sort when compiling device code.
 */
@@ -330,7 +598,8 @@ struct intro_sort_device_max_depth
 };
 
 /*!
-    \brief cutoff for intro sort to use insertion sort on small ranges.
+    \brief cutoff for intro sort to use a sorting network or insertion sort
+    on small ranges.
 */
 struct intro_sort_insertion_sort_cutoff
 {
@@ -364,8 +633,8 @@ intro_sort(Iter begin,
 
   } else if (N < insertion_sort_cutoff) {
 
-    // use insertion sort for small inputs
-    detail::insertion_sort(begin, end, comp);
+    // use sorting network or insertion sort for small inputs
+    detail::small_sort(begin, end, comp);
 
   } else if (depth == 0) {
 
@@ -397,7 +666,7 @@ intro_sort(Iter begin,
     }
 
     // partition
-    mid = partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
+    mid = detail::partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
 
     // swap pivot to sorted position
     if (mid != pivot) {
@@ -412,6 +681,87 @@ intro_sort(Iter begin,
   }
 }
 
+/*!
+    \brief unstable intro select given range inplace using comparison function
+    so nth holds the item it would hold if the range were sorted, items in
+    [begin, nth) are not greater and items in (nth, end) are not less,
+    using O(N) expected comparisons and O(1) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_HOST_DEVICE inline
+void
+intro_select(Iter begin,
+             Iter nth,
+             Iter end,
+             Compare comp,
+             unsigned depth)
+{
+  using RAJA::safe_iter_swap;
+  using diff_type = ::RAJA::detail::IterDiff<Iter>;
+
+  // cutoff to use insertion sort
+  constexpr diff_type insertion_sort_cutoff =
+      static_cast<diff_type>(intro_sort_insertion_sort_cutoff::get());
+
+  if (nth == end) {
+    return;
+  }
+
+  while (end - begin >= insertion_sort_cutoff) {
+
+    if (depth == 0) {
+
+      // use heap select if iterate too long
+      detail::heap_select(begin, RAJA::next(nth), end, comp);
+      return;
+    }
+    --depth;
+
+    // use quick select
+    // choose pivot with median of 3 (N >= insertion_sort_cutoff)
+    Iter mid = begin + (end - begin)/2;
+    Iter last = end-1;
+    Iter pivot = comp(*begin, *mid)
+                    ? ( comp(*mid, *last)
+                           ? mid
+                           : ( comp(*begin, *last)
+                                  ? last
+                                  : begin ) )
+                    : ( comp(*mid, *last)
+                           ? ( comp(*begin, *last)
+                                  ? begin
+                                  : last )
+                           : mid );
+
+    // swap pivot to last
+    if (pivot != last) {
+      safe_iter_swap(pivot, last);
+      pivot = last;
+    }
+
+    // partition
+    mid = detail::partition(begin, last, [&](Iter it){ return comp(*it, *pivot); });
+
+    // swap pivot to sorted position
+    if (mid != pivot) {
+      safe_iter_swap(mid, pivot);
+      pivot = mid;
+    }
+
+    // continue in the part holding nth, ignoring already placed pivot
+    if (nth == pivot) {
+      return;
+    } else if (nth < pivot) {
+      end = pivot;
+    } else {
+      begin = RAJA::next(pivot);
+    }
+  }
+
+  // use sorting network or insertion sort for small inputs
+  detail::small_sort(begin, end, comp);
+}
+
 /*!
     \brief merge a range with midpoint using comparison function
     with local range/2 copy
@@ -555,15 +905,151 @@ merge_like_std( Iter1 first1,
 }
 
 /*!
-    \brief stable merge sort given range inplace using comparison function
-    and using O(N*lg(N)) comparisons and O(N) memory
+    \brief find where diagonal diag of the merge of sorted ranges
+    [a, a+a_len) and [b, b+b_len) crosses the merge path, returns the number
+    of items taken from a by the first diag items of the stable merge
+    using O(lg(N)) comparisons
 */
-template <typename Iter, typename Compare>
-RAJA_INLINE 
+template <typename IterA, typename IterB, typename Compare>
+RAJA_INLINE
+RAJA::detail::IterDiff<IterA>
+merge_path_split(IterA a,
+                 RAJA::detail::IterDiff<IterA> a_len,
+                 IterB b,
+                 RAJA::detail::IterDiff<IterA> b_len,
+                 RAJA::detail::IterDiff<IterA> diag,
+                 Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<IterA>;
+
+  diff_type lo = (diag > b_len) ? diag - b_len : 0;
+  diff_type hi = (diag < a_len) ? diag : a_len;
+
+  while (lo < hi) {
+    diff_type mid = lo + (hi - lo) / 2;
+    // items of a equivalent to items of b are taken first
+    if (comp(b[diag - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+/*!
+    \brief stable merge given two sorted ranges into d_first by moving
+    using comparison function and using O(N) comparisons
+*/
+template <typename IterA, typename IterB, typename OutIter, typename Compare>
+RAJA_INLINE
+void
+merge_move(IterA first1,
+           IterA last1,
+           IterB first2,
+           IterB last2,
+           OutIter d_first,
+           Compare comp)
+{
+  for (; first1 != last1 && first2 != last2; ++d_first) {
+    if (comp(*first2, *first1)) {
+      *d_first = std::move(*first2);
+      ++first2;
+    } else {
+      *d_first = std::move(*first1);
+      ++first1;
+    }
+  }
+  d_first = std::move(first1, last1, d_first);
+  std::move(first2, last2, d_first);
+}
+
+/*!
+    \brief default allocator for the scratch memory of the sorts,
+           allocates RAJA::DATA_ALIGN aligned memory
+*/
+template <typename T>
+struct SortScratchAllocator
+{
+  using value_type = T;
+
+  SortScratchAllocator() = default;
+
+  template <typename U>
+  SortScratchAllocator(SortScratchAllocator<U> const&) { }
+
+  T* allocate(size_t n)
+  {
+    T* ptr = RAJA::allocate_aligned_type<T>( RAJA::DATA_ALIGN, n * sizeof(T) );
+
+    // check memory allocation worked
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW( "sort temporary memory allocation failed" );
+    }
+
+    return ptr;
+  }
+
+  void deallocate(T* ptr, size_t)
+  {
+    RAJA::free_aligned(ptr);
+  }
+
+  template <typename U>
+  bool operator==(SortScratchAllocator<U> const&) const { return true; }
+
+  template <typename U>
+  bool operator!=(SortScratchAllocator<U> const&) const { return false; }
+};
+
+/*!
+    \brief scratch memory for n items allocated with a rebound copy of
+           the given allocator, destroys the first constructed items
+*/
+template <typename T, typename Allocator>
+struct SortScratch
+{
+  using allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+  using allocator_traits_type = std::allocator_traits<allocator_type>;
+
+  allocator_type allocator;
+  size_t size;
+  T* data;
+  size_t constructed = 0;
+
+  SortScratch(Allocator const& allocator_, size_t size_)
+    : allocator(allocator_)
+    , size(size_)
+    , data(allocator_traits_type::allocate(allocator, size))
+  { }
+
+  SortScratch(SortScratch const&) = delete;
+  SortScratch& operator=(SortScratch const&) = delete;
+
+  ~SortScratch()
+  {
+    for (size_t i = 0; i < constructed; ++i) {
+      data[i].~T();
+    }
+    allocator_traits_type::deallocate(allocator, data, size);
+  }
+};
+
+/*!
+    \brief stable merge sort given range inplace using comparison function,
+    merging through copyarr, uninitialized memory for end-begin items, and
+    counting the items of copyarr it constructs in constructed
+*/
+template <typename Iter, typename Compare, typename DiffType>
+RAJA_INLINE
 void
 merge_sort(Iter begin,
            Iter end,
-           Compare comp)
+           Compare comp,
+           RAJA::detail::IterVal<Iter>* copyarr,
+           DiffType& constructed)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
   using value_type = RAJA::detail::IterVal<Iter>;
@@ -591,24 +1077,9 @@ merge_sort(Iter begin,
 
     // merge using extra storage
 
-    // Manage the lifetime of the buffer and objects constructed in the buffer
-    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
-    buf_deleter_type buf_deleter;
-
-    std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
-        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, len * sizeof(value_type) ),
-        buf_deleter);
-
-    value_type* copyarr = copy_buf.get();
-
-    // check memory allocation worked
-    if (copyarr == nullptr) {
-      RAJA_ABORT_OR_THROW( "merge_sort temporary memory allocation failed" );
-    }
-
     // move construct input into buffer storage
-    // use buf_deleter.size as index to keep track of objects constructed
-    for ( diff_type& cc = buf_deleter.size; cc < len; ++cc )
+    // use constructed as index to keep track of objects constructed
+    for ( DiffType& cc = constructed; cc < static_cast<DiffType>(len); ++cc )
     {
       new(&copyarr[cc]) value_type(std::move(begin[cc]));
     }
@@ -667,6 +1138,47 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(N) memory allocated with
+    scratch_allocator
+*/
+template <typename Iter, typename Compare, typename Allocator>
+RAJA_INLINE
+void
+merge_sort(Iter begin,
+           Iter end,
+           Compare comp,
+           Allocator const& scratch_allocator)
+{
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  static constexpr auto insertion_sort_cutoff = 16;
+  if ( end - begin <= insertion_sort_cutoff )
+  {
+    detail::insertion_sort( begin, end, comp );
+    return;
+  }
+
+  SortScratch<value_type, Allocator> scratch(scratch_allocator, end - begin);
+
+  detail::merge_sort( begin, end, comp, scratch.data, scratch.constructed );
+}
+
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(N) memory
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+merge_sort(Iter begin,
+           Iter end,
+           Compare comp)
+{
+  detail::merge_sort( begin, end, comp, SortScratchAllocator<char>{} );
+}
+
 }  // namespace detail
 
 /*!
@@ -779,6 +1291,27 @@ merge_sort(Iter begin,
   }
 }
 
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(N) memory allocated with
+    scratch_allocator
+*/
+template <typename Iter, typename Compare, typename Allocator>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_iterator<Iter>>
+merge_sort(Iter begin,
+           Iter end,
+           Compare comp,
+           Allocator const& scratch_allocator)
+{
+  auto N = end - begin;
+
+  if (N > 1) {
+
+    detail::merge_sort(begin, end, comp, scratch_allocator);
+  }
+}
+
 }  // namespace RAJA
 
 #endif
@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_HISTOGRAM_HISTOGRAM_HPP__
+#define __TEST_HISTOGRAM_HISTOGRAM_HPP__
+
+template <typename EXEC_POLICY, typename T>
+void HistogramTestImpl(int N, int num_bins, bool skewed)
+{
+  std::vector<int> idx = makeHistogramIndices(N, num_bins, skewed);
+
+  std::vector<T> expected(num_bins, T(0));
+  for (int i = 0; i < N; ++i) {
+    expected[idx[i]] += T(1);
+  }
+
+  for (RAJA::ScatterStrategy strategy : histogram_test_strategies) {
+
+    std::vector<T> counts(num_bins, T(0));
+
+    RAJA::histogram<EXEC_POLICY>(idx.data(),
+                                 idx.data() + N,
+                                 counts.data(),
+                                 num_bins,
+                                 strategy);
+
+    for (int b = 0; b < num_bins; ++b) {
+      ASSERT_EQ(counts[b], expected[b]);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(HistogramTest);
+template <typename T>
+class HistogramTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(HistogramTest, Histogram)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using BIN_TYPE    = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  HistogramTestImpl<EXEC_POLICY, BIN_TYPE>(0, 10, false);
+  HistogramTestImpl<EXEC_POLICY, BIN_TYPE>(357, 1, false);
+  HistogramTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 16, false);
+  HistogramTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 50000, false);
+  HistogramTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 50000, true);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(HistogramTest,
+                            Histogram);
+
+#endif // __TEST_HISTOGRAM_HISTOGRAM_HPP__
@@ -0,0 +1,60 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_HISTOGRAM_SCATTERADD_HPP__
+#define __TEST_HISTOGRAM_SCATTERADD_HPP__
+
+template <typename EXEC_POLICY, typename T>
+void ScatterAddTestImpl(int N, int num_bins, bool skewed)
+{
+  std::vector<int> idx = makeHistogramIndices(N, num_bins, skewed);
+
+  std::vector<T> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = static_cast<T>(i % 17);
+  }
+
+  std::vector<T> expected(num_bins, T(3));
+  for (int i = 0; i < N; ++i) {
+    expected[idx[i]] += vals[i];
+  }
+
+  for (RAJA::ScatterStrategy strategy : histogram_test_strategies) {
+
+    std::vector<T> bins(num_bins, T(3));
+
+    RAJA::scatter_add<EXEC_POLICY>(idx, vals, bins, strategy);
+
+    for (int b = 0; b < num_bins; ++b) {
+      ASSERT_EQ(bins[b], expected[b]);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(ScatterAddTest);
+template <typename T>
+class ScatterAddTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScatterAddTest, ScatterAdd)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using BIN_TYPE    = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ScatterAddTestImpl<EXEC_POLICY, BIN_TYPE>(0, 10, false);
+  ScatterAddTestImpl<EXEC_POLICY, BIN_TYPE>(357, 1, false);
+  ScatterAddTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 16, false);
+  ScatterAddTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 50000, false);
+  ScatterAddTestImpl<EXEC_POLICY, BIN_TYPE>(32000, 50000, true);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScatterAddTest,
+                            ScatterAdd);
+
+#endif // __TEST_HISTOGRAM_SCATTERADD_HPP__
@@ -0,0 +1,39 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_HISTOGRAM_DATA_HPP__
+#define __TEST_HISTOGRAM_DATA_HPP__
+
+#include <random>
+#include <vector>
+
+//
+// Strategies exercised by every histogram test.
+//
+static const RAJA::ScatterStrategy histogram_test_strategies[] = {
+    RAJA::ScatterStrategy::automatic,
+    RAJA::ScatterStrategy::privatized,
+    RAJA::ScatterStrategy::atomic,
+    RAJA::ScatterStrategy::sort_reduce};
+
+//
+// Fill bin indices in [0, num_bins), sending every other index to one
+// bin when skewed so a single bin sees heavy contention.
+//
+inline std::vector<int> makeHistogramIndices(int N, int num_bins, bool skewed)
+{
+  std::mt19937 gen(N + num_bins);
+  std::uniform_int_distribution<int> dist(0, num_bins - 1);
+
+  std::vector<int> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = (skewed && (i % 2 == 0)) ? num_bins / 2 : dist(gen);
+  }
+  return idx;
+}
+
+#endif // __TEST_HISTOGRAM_DATA_HPP__
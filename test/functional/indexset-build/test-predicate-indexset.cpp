@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for building index sets from predicates
+/// and label arrays.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+template <typename EXEC_POLICY>
+void PredicateIndexSetTestImpl()
+{
+  using RSType = RAJA::RangeSegment;
+  using LSType = RAJA::ListSegment;
+
+  const RAJA::Index_type range_min_length = 8;
+
+  //
+  // Label 1 is given to indices:
+  // {0, 1, ..., 9,  12,  14, 15,  20, 21, ..., 9019,  9021}
+  // so the runs of 10 and 9000 indices become ranges, and the indices
+  // in between become one list segment each.
+  //
+  const RAJA::Index_type N = 9030;
+  std::vector<int> labels(N, 0);
+  for (RAJA::Index_type i = 0; i < 10; ++i) labels[i] = 1;
+  labels[12] = 1;
+  labels[14] = 1;
+  labels[15] = 1;
+  for (RAJA::Index_type i = 20; i < 9020; ++i) labels[i] = 1;
+  labels[9021] = 1;
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RSType, LSType> iset;
+
+  RAJA::buildIndexSetFromLabels<EXEC_POLICY>(
+      iset, res, labels.data(), N, 1, range_min_length);
+
+  ASSERT_EQ(iset.getLength(), 10 + 3 + 9000 + 1);
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 10);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 3);
+  ASSERT_EQ(*s1.begin(), 12);
+  ASSERT_EQ(*(s1.begin() + 2), 15);
+
+  const RSType& s2 = iset.getSegment<const RSType>(2);
+  ASSERT_EQ(s2.size(), 9000);
+  ASSERT_EQ(*s2.begin(), 20);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 1);
+  ASSERT_EQ(*s3.begin(), 9021);
+
+  //
+  // The complement, built from a predicate.
+  //
+  RAJA::TypedIndexSet<RSType, LSType> iset_not;
+
+  const int* lab = labels.data();
+  RAJA::buildIndexSetFromPredicate<EXEC_POLICY>(
+      iset_not,
+      res,
+      N,
+      [=](RAJA::Index_type i) { return lab[i] != 1; },
+      range_min_length);
+
+  ASSERT_EQ(iset_not.getLength(), N - iset.getLength());
+
+  std::vector<RAJA::Index_type> indices;
+  RAJA::getIndices(indices, iset_not);
+  for (RAJA::Index_type idx : indices) {
+    ASSERT_NE(labels[idx], 1);
+  }
+}
+
+TEST(IndexSetBuild, PredicateSequential)
+{
+  PredicateIndexSetTestImpl<RAJA::seq_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, PredicateOpenMP)
+{
+  PredicateIndexSetTestImpl<RAJA::omp_parallel_for_exec>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(IndexSetBuild, PredicateTBB)
+{
+  PredicateIndexSetTestImpl<RAJA::tbb_for_exec>();
+}
+#endif
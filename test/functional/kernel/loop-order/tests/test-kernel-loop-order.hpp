@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_LOOP_ORDER_HPP__
+#define __TEST_KERNEL_LOOP_ORDER_HPP__
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_same<RAJA::all_loop_orders<3>,
+                           camp::list<RAJA::PERM_IJK,
+                                      RAJA::PERM_IKJ,
+                                      RAJA::PERM_JIK,
+                                      RAJA::PERM_JKI,
+                                      RAJA::PERM_KIJ,
+                                      RAJA::PERM_KJI>>::value,
+              "all_loop_orders<3> must list the PERM_* orders");
+
+template <typename INDEX_TYPE, typename Search>
+void KernelLoopOrderTestImpl(Search& search,
+                             INDEX_TYPE ni,
+                             INDEX_TYPE nj,
+                             INDEX_TYPE nk,
+                             int num_launches)
+{
+  const INDEX_TYPE N = ni * nj * nk;
+
+  std::vector<INDEX_TYPE> a_data(N);
+  std::vector<INDEX_TYPE> b_data(N, INDEX_TYPE(0));
+
+  for (INDEX_TYPE i = 0; i < N; ++i) {
+    a_data[i] = i % INDEX_TYPE(7);
+  }
+
+  // a is traversed with unit stride in i, b with unit stride in k
+  RAJA::View<INDEX_TYPE, RAJA::Layout<3>> a(a_data.data(), nk, nj, ni);
+  RAJA::View<INDEX_TYPE, RAJA::Layout<3>> b(b_data.data(), ni, nj, nk);
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> iseg(0, ni);
+  RAJA::TypedRangeSegment<INDEX_TYPE> jseg(0, nj);
+  RAJA::TypedRangeSegment<INDEX_TYPE> kseg(0, nk);
+
+  for (int l = 0; l < num_launches; ++l) {
+    search.kernel(RAJA::make_tuple(iseg, jseg, kseg),
+                  [=](INDEX_TYPE i, INDEX_TYPE j, INDEX_TYPE k) {
+                    b(i, j, k) += a(k, j, i);
+                  });
+  }
+
+  for (INDEX_TYPE i = 0; i < ni; ++i) {
+    for (INDEX_TYPE j = 0; j < nj; ++j) {
+      for (INDEX_TYPE k = 0; k < nk; ++k) {
+        ASSERT_EQ(b(i, j, k), a(k, j, i) * static_cast<INDEX_TYPE>(num_launches));
+      }
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelLoopOrderTest);
+template <typename T>
+class KernelLoopOrderTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelLoopOrderTest, AllOrders)
+{
+  using INDEX_TYPE   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLS    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OUTER_POLICY = typename camp::at<EXEC_POLS, camp::num<0>>::type;
+  using INNER_POLICY = typename camp::at<EXEC_POLS, camp::num<1>>::type;
+
+  using Search = RAJA::LoopOrderSearch<RAJA::all_loop_orders<3>,
+                                       OUTER_POLICY,
+                                       INNER_POLICY,
+                                       RAJA::statement::Lambda<0>>;
+  ASSERT_EQ(static_cast<size_t>(Search::num_orders), 6u);
+
+  Search search(2);
+  ASSERT_FALSE(search.is_tuned());
+
+  // every order is timed twice, then the fastest one is used
+  KernelLoopOrderTestImpl<INDEX_TYPE>(search, INDEX_TYPE(7), INDEX_TYPE(5), INDEX_TYPE(9), 11);
+  ASSERT_FALSE(search.is_tuned());
+  KernelLoopOrderTestImpl<INDEX_TYPE>(search, INDEX_TYPE(7), INDEX_TYPE(5), INDEX_TYPE(9), 4);
+  ASSERT_TRUE(search.is_tuned());
+  ASSERT_GE(search.best(), 0);
+  ASSERT_LT(search.best(), 6);
+
+  auto order = search.best_order();
+  std::sort(order.begin(), order.end());
+  ASSERT_EQ(order[0], 0);
+  ASSERT_EQ(order[1], 1);
+  ASSERT_EQ(order[2], 2);
+
+  search.reset();
+  ASSERT_FALSE(search.is_tuned());
+  KernelLoopOrderTestImpl<INDEX_TYPE>(search, INDEX_TYPE(3), INDEX_TYPE(11), INDEX_TYPE(4), 13);
+  ASSERT_TRUE(search.is_tuned());
+}
+
+TYPED_TEST_P(KernelLoopOrderTest, SelectedOrders)
+{
+  using INDEX_TYPE   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLS    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OUTER_POLICY = typename camp::at<EXEC_POLS, camp::num<0>>::type;
+  using INNER_POLICY = typename camp::at<EXEC_POLS, camp::num<1>>::type;
+
+  using Search = RAJA::LoopOrderSearch<camp::list<RAJA::PERM_KJI, RAJA::PERM_JIK>,
+                                       OUTER_POLICY,
+                                       INNER_POLICY,
+                                       RAJA::statement::Lambda<0>>;
+  Search search;
+
+  KernelLoopOrderTestImpl<INDEX_TYPE>(search, INDEX_TYPE(13), INDEX_TYPE(1), INDEX_TYPE(6), 5);
+  ASSERT_TRUE(search.is_tuned());
+
+  auto order = search.best_order();
+  if (search.best() == 0) {
+    ASSERT_EQ(order[0], 2);
+    ASSERT_EQ(order[1], 1);
+    ASSERT_EQ(order[2], 0);
+  } else {
+    ASSERT_EQ(order[0], 1);
+    ASSERT_EQ(order[1], 0);
+    ASSERT_EQ(order[2], 2);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelLoopOrderTest,
+                            AllOrders,
+                            SelectedOrders);
+
+#endif  // __TEST_KERNEL_LOOP_ORDER_HPP__
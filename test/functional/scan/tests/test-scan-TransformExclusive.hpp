@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_TRANSFORMEXCLUSIVE_HPP__
+#define __TEST_SCAN_TRANSFORMEXCLUSIVE_HPP__
+
+#include <numeric>
+
+template <typename T>
+struct ScanTransformNegate
+{
+  T operator()(const T& x) const { return -x; }
+};
+
+template <typename OP, typename T>
+::testing::AssertionResult check_transform_exclusive(const T* actual,
+                                                     const T* original,
+                                                     int N,
+                                                     T init = OP::identity())
+{
+  for (int i = 0; i < N; ++i) {
+    if (*actual != init) {
+      return ::testing::AssertionFailure()
+             << *actual << " != " << init << " (at index " << i << ")";
+    }
+    init = OP()(init, ScanTransformNegate<T>{}(*original));
+    ++actual;
+    ++original;
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanTransformExclusiveTestImpl(int N,
+                                    typename OP_TYPE::result_type offset = 
+                                    OP_TYPE::identity(),
+                                    bool inplace = false)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N, 
+                    working_res,
+                    &work_in, &work_out, 
+                    &host_in, &host_out);
+
+  std::iota(host_in, host_in + N, 1);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  T* work_res_out = inplace ? work_in : work_out;
+
+  RAJA::transform_exclusive_scan<EXEC_POLICY>(work_in,
+                                              work_in + N,
+                                              work_res_out,
+                                              ScanTransformNegate<T>{},
+                                              OP_TYPE{},
+                                              offset);
+
+  working_res.memcpy(host_out, work_res_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_transform_exclusive<OP_TYPE>(host_out, host_in, N, offset));
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,             
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanTransformExclusiveTest);
+template <typename T>
+class ScanTransformExclusiveTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanTransformExclusiveTest, ScanTransformExclusive)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(0);
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(357);
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(32000);
+
+  //
+  // Perform some non-identity offset tests
+  // 
+  using T = typename OP_TYPE::result_type;
+
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(357, T(15));
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(32000, T(2));
+
+  //
+  // Scan in place, reading each input before its output is written
+  //
+  ScanTransformExclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(32000, T(2), true);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanTransformExclusiveTest, 
+                            ScanTransformExclusive);
+
+#endif // __TEST_SCAN_TRANSFORMEXCLUSIVE_HPP__
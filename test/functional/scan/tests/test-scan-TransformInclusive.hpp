@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_TRANSFORMINCLUSIVE_HPP__
+#define __TEST_SCAN_TRANSFORMINCLUSIVE_HPP__
+
+#include <numeric>
+
+template <typename T>
+struct ScanTransformNegate
+{
+  T operator()(const T& x) const { return -x; }
+};
+
+template <typename OP>
+::testing::AssertionResult check_transform_inclusive(
+  const typename OP::result_type* actual,
+  const typename OP::result_type* original,
+  int N)
+{
+  using T = typename OP::result_type;
+  T init = OP::identity();
+  for (int i = 0; i < N; ++i) {
+    init = OP()(init, ScanTransformNegate<T>{}(*original));
+    if (*actual != init) {
+      return ::testing::AssertionFailure()
+             << *actual << " != " << init << " (at index " << i << ")";
+    }
+    ++actual;
+    ++original;
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanTransformInclusiveTestImpl(int N, bool inplace = false)
+{
+  using T = typename OP_TYPE::result_type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N, 
+                    working_res,
+                    &work_in, &work_out, 
+                    &host_in, &host_out);
+
+  std::iota(host_in, host_in + N, 1);
+
+  working_res.memcpy(work_in, host_in, sizeof(T) * N);
+
+  T* work_res_out = inplace ? work_in : work_out;
+
+  RAJA::transform_inclusive_scan<EXEC_POLICY>(work_in,
+                                              work_in + N,
+                                              work_res_out,
+                                              ScanTransformNegate<T>{},
+                                              OP_TYPE{});
+
+  working_res.memcpy(host_out, work_res_out, sizeof(T) * N);
+
+  ASSERT_TRUE(check_transform_inclusive<OP_TYPE>(host_out, host_in, N));
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,             
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanTransformInclusiveTest);
+template <typename T>
+class ScanTransformInclusiveTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanTransformInclusiveTest, ScanTransformInclusive)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanTransformInclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(0);
+  ScanTransformInclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(357);
+  ScanTransformInclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(32000);
+
+  //
+  // Scan in place, reading each input before its output is written
+  //
+  ScanTransformInclusiveTestImpl<EXEC_POLICY, 
+                                 WORKING_RESOURCE, 
+                                 OP_TYPE>(32000, true);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanTransformInclusiveTest, 
+                            ScanTransformInclusive);
+
+#endif // __TEST_SCAN_TRANSFORMINCLUSIVE_HPP__
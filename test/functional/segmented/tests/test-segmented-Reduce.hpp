@@ -0,0 +1,61 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_REDUCE_HPP__
+#define __TEST_SEGMENTED_REDUCE_HPP__
+
+template <typename EXEC_POLICY, typename T>
+void SegmentedReduceTestImpl(int num_segments, int big_len)
+{
+  std::vector<int> offsets = makeSegmentOffsets(num_segments, big_len);
+  std::vector<T> vals = makeSegmentValues<T>(offsets[num_segments]);
+
+  std::vector<T> sums(num_segments, T(-1));
+  std::vector<T> maxs(num_segments, T(-1));
+
+  RAJA::segmented_reduce<EXEC_POLICY>(vals, offsets, sums);
+  RAJA::segmented_reduce<EXEC_POLICY>(vals.data(),
+                                      offsets.data(),
+                                      offsets.data() + num_segments + 1,
+                                      maxs.data(),
+                                      RAJA::operators::maximum<T>{},
+                                      T(-2));
+
+  for (int s = 0; s < num_segments; ++s) {
+    T sum = T(0);
+    T max = T(-2);
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      sum += vals[i];
+      max = (vals[i] > max) ? vals[i] : max;
+    }
+    ASSERT_EQ(sums[s], sum);
+    ASSERT_EQ(maxs[s], max);
+  }
+}
+
+
+TYPED_TEST_SUITE_P(SegmentedReduceTest);
+template <typename T>
+class SegmentedReduceTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedReduceTest, SegmentedReduce)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using VALUE_TYPE  = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SegmentedReduceTestImpl<EXEC_POLICY, VALUE_TYPE>(1, 0);
+  SegmentedReduceTestImpl<EXEC_POLICY, VALUE_TYPE>(7, 0);
+  SegmentedReduceTestImpl<EXEC_POLICY, VALUE_TYPE>(5000, 0);
+  SegmentedReduceTestImpl<EXEC_POLICY, VALUE_TYPE>(100, 50000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedReduceTest,
+                            SegmentedReduce);
+
+#endif // __TEST_SEGMENTED_REDUCE_HPP__
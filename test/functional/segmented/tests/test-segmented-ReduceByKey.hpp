@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_REDUCEBYKEY_HPP__
+#define __TEST_SEGMENTED_REDUCEBYKEY_HPP__
+
+template <typename EXEC_POLICY, typename T>
+void SegmentedReduceByKeyTestImpl(int num_segments, int big_len)
+{
+  std::vector<int> offsets = makeSegmentOffsets(num_segments, big_len);
+  const int N = offsets[num_segments];
+  std::vector<T> vals = makeSegmentValues<T>(N);
+
+  // give each segment its own key, so empty segments produce no run
+  std::vector<int> keys(N);
+  std::vector<int> expected_keys;
+  std::vector<T> expected_sums;
+  std::vector<int> expected_counts;
+  for (int s = 0; s < num_segments; ++s) {
+    if (offsets[s] == offsets[s + 1]) {
+      continue;
+    }
+    T sum = T(0);
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      keys[i] = 2 * s;
+      sum += vals[i];
+    }
+    expected_keys.push_back(2 * s);
+    expected_sums.push_back(sum);
+    expected_counts.push_back(offsets[s + 1] - offsets[s]);
+  }
+  const int num_runs = static_cast<int>(expected_keys.size());
+
+  std::vector<int> keys_out(N);
+  std::vector<T> sums(N);
+  std::vector<int> unique(N);
+  std::vector<int> counts(N);
+
+  ASSERT_EQ(RAJA::reduce_by_key<EXEC_POLICY>(keys, vals, keys_out, sums),
+            num_runs);
+  ASSERT_EQ(RAJA::run_length_encode<EXEC_POLICY>(keys.data(),
+                                                 keys.data() + N,
+                                                 unique.data(),
+                                                 counts.data()),
+            num_runs);
+
+  for (int r = 0; r < num_runs; ++r) {
+    ASSERT_EQ(keys_out[r], expected_keys[r]);
+    ASSERT_EQ(sums[r], expected_sums[r]);
+    ASSERT_EQ(unique[r], expected_keys[r]);
+    ASSERT_EQ(counts[r], expected_counts[r]);
+  }
+}
+
+//
+// Values for reductions whose identity is not T(0): shifted to [1, 100] for
+// minimum and maximum, and +-1 for multiplies so products stay exact.
+//
+template <typename OP_TYPE>
+struct ReduceByKeyOpValue {
+  template <typename T>
+  static T get(T v)
+  {
+    return v + T(1);
+  }
+};
+
+template <typename T>
+struct ReduceByKeyOpValue<RAJA::operators::multiplies<T>> {
+  static T get(T v) { return (static_cast<int>(v) % 2 == 0) ? T(1) : T(-1); }
+};
+
+template <typename EXEC_POLICY, typename T, typename OP_TYPE>
+void checkReduceByKeyOp(const std::vector<int>& keys, std::vector<T> vals)
+{
+  const int N = static_cast<int>(keys.size());
+  for (int i = 0; i < N; ++i) {
+    vals[i] = ReduceByKeyOpValue<OP_TYPE>::get(vals[i]);
+  }
+
+  std::vector<T> expected;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      expected.push_back(vals[i]);
+    } else {
+      expected.back() = OP_TYPE{}(expected.back(), vals[i]);
+    }
+  }
+  const int num_runs = static_cast<int>(expected.size());
+
+  std::vector<int> keys_out(N);
+  std::vector<T> out(N);
+
+  ASSERT_EQ(RAJA::reduce_by_key<EXEC_POLICY>(keys, vals, keys_out, out,
+                                             OP_TYPE{}),
+            num_runs);
+
+  for (int r = 0; r < num_runs; ++r) {
+    ASSERT_EQ(out[r], expected[r]);
+  }
+}
+
+template <typename EXEC_POLICY, typename T, typename OP_TYPE>
+void SegmentedReduceByKeyOpTestImpl(int num_segments, int big_len)
+{
+  std::vector<int> offsets = makeSegmentOffsets(num_segments, big_len);
+  const int N = offsets[num_segments];
+
+  std::vector<int> keys(N);
+  for (int s = 0; s < num_segments; ++s) {
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      keys[i] = s;
+    }
+  }
+  checkReduceByKeyOp<EXEC_POLICY, T, OP_TYPE>(keys, makeSegmentValues<T>(N));
+}
+
+//
+// Runs two chunks long on inputs split into num_chunks equal chunks, so each
+// run covers a whole chunk and the next run starts exactly at a chunk
+// boundary whenever the back-end uses num_chunks chunks.
+//
+template <typename EXEC_POLICY, typename T, typename OP_TYPE>
+void SegmentedReduceByKeyChunkTestImpl(int num_chunks)
+{
+  const int chunk_len = static_cast<int>(
+      RAJA::detail::segmented::get_min_iterates_per_thread());
+  const int N = chunk_len * num_chunks;
+
+  std::vector<int> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = i / (2 * chunk_len);
+  }
+  checkReduceByKeyOp<EXEC_POLICY, T, OP_TYPE>(keys, makeSegmentValues<T>(N));
+}
+
+
+TYPED_TEST_SUITE_P(SegmentedReduceByKeyTest);
+template <typename T>
+class SegmentedReduceByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedReduceByKeyTest, ReduceByKey)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using VALUE_TYPE  = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SegmentedReduceByKeyTestImpl<EXEC_POLICY, VALUE_TYPE>(1, 0);
+  SegmentedReduceByKeyTestImpl<EXEC_POLICY, VALUE_TYPE>(7, 0);
+  SegmentedReduceByKeyTestImpl<EXEC_POLICY, VALUE_TYPE>(5000, 0);
+  SegmentedReduceByKeyTestImpl<EXEC_POLICY, VALUE_TYPE>(100, 50000);
+
+  //
+  // Operators whose identity is not VALUE_TYPE{}, including runs that span
+  // whole chunks of the parallel back-ends
+  //
+  using MinOp = RAJA::operators::minimum<VALUE_TYPE>;
+  using MaxOp = RAJA::operators::maximum<VALUE_TYPE>;
+  using MulOp = RAJA::operators::multiplies<VALUE_TYPE>;
+
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MinOp>(5000, 0);
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MinOp>(100, 50000);
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MaxOp>(5000, 0);
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MaxOp>(100, 50000);
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MulOp>(5000, 0);
+  SegmentedReduceByKeyOpTestImpl<EXEC_POLICY, VALUE_TYPE, MulOp>(100, 50000);
+
+  for (int num_chunks = 3; num_chunks <= 16; ++num_chunks) {
+    SegmentedReduceByKeyChunkTestImpl<EXEC_POLICY, VALUE_TYPE, MinOp>(
+        num_chunks);
+    SegmentedReduceByKeyChunkTestImpl<EXEC_POLICY, VALUE_TYPE, MaxOp>(
+        num_chunks);
+    SegmentedReduceByKeyChunkTestImpl<EXEC_POLICY, VALUE_TYPE, MulOp>(
+        num_chunks);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedReduceByKeyTest,
+                            ReduceByKey);
+
+#endif // __TEST_SEGMENTED_REDUCEBYKEY_HPP__
@@ -0,0 +1,67 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_SCAN_HPP__
+#define __TEST_SEGMENTED_SCAN_HPP__
+
+template <typename EXEC_POLICY, typename T>
+void SegmentedScanTestImpl(int num_segments, int big_len)
+{
+  std::vector<int> offsets = makeSegmentOffsets(num_segments, big_len);
+  const int N = offsets[num_segments];
+  std::vector<T> vals = makeSegmentValues<T>(N);
+
+  std::vector<int> keys(N);
+  for (int s = 0; s < num_segments; ++s) {
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      keys[i] = s;
+    }
+  }
+
+  std::vector<T> incl(N);
+  std::vector<T> excl(N);
+
+  RAJA::segmented_inclusive_scan<EXEC_POLICY>(vals, keys, incl.begin());
+  RAJA::segmented_exclusive_scan<EXEC_POLICY>(vals.begin(),
+                                              vals.end(),
+                                              keys.begin(),
+                                              excl.begin(),
+                                              RAJA::operators::plus<T>{},
+                                              T(3));
+
+  for (int s = 0; s < num_segments; ++s) {
+    T sum = T(0);
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      ASSERT_EQ(excl[i], T(3) + sum);
+      sum += vals[i];
+      ASSERT_EQ(incl[i], sum);
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(SegmentedScanTest);
+template <typename T>
+class SegmentedScanTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedScanTest, SegmentedScan)
+{
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<0>>::type;
+  using VALUE_TYPE  = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  SegmentedScanTestImpl<EXEC_POLICY, VALUE_TYPE>(1, 0);
+  SegmentedScanTestImpl<EXEC_POLICY, VALUE_TYPE>(7, 0);
+  SegmentedScanTestImpl<EXEC_POLICY, VALUE_TYPE>(5000, 0);
+  SegmentedScanTestImpl<EXEC_POLICY, VALUE_TYPE>(100, 50000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedScanTest,
+                            SegmentedScan);
+
+#endif // __TEST_SEGMENTED_SCAN_HPP__
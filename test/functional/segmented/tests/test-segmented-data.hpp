@@ -0,0 +1,50 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SEGMENTED_DATA_HPP__
+#define __TEST_SEGMENTED_DATA_HPP__
+
+#include <random>
+#include <vector>
+
+//
+// Make offsets for num_segments segments where roughly a third are empty,
+// and when big_len is non-zero a few segments have that many elements so
+// the work is very uneven across segments.
+//
+inline std::vector<int> makeSegmentOffsets(int num_segments, int big_len)
+{
+  std::mt19937 gen(num_segments + big_len);
+  std::uniform_int_distribution<int> dist(0, 9);
+
+  std::vector<int> offsets(num_segments + 1);
+  offsets[0] = 0;
+  for (int s = 0; s < num_segments; ++s) {
+    const int r = dist(gen);
+    const int len = (r < 3) ? 0 : (r == 9 && big_len > 0) ? big_len : 5 * r;
+    offsets[s + 1] = offsets[s] + len;
+  }
+  return offsets;
+}
+
+//
+// Fill values with small integers so sums are exact in every value type.
+//
+template <typename T>
+std::vector<T> makeSegmentValues(int N)
+{
+  std::mt19937 gen(N);
+  std::uniform_int_distribution<int> dist(0, 99);
+
+  std::vector<T> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = static_cast<T>(dist(gen));
+  }
+  return vals;
+}
+
+#endif // __TEST_SEGMENTED_DATA_HPP__
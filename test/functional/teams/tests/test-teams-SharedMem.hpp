@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_SHARED_MEM_HPP__
+#define __TEST_TEAMS_SHARED_MEM_HPP__
+
+#include <numeric>
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsSharedMemTestImpl()
+{
+
+  int N = 100;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(N), N*sizeof(int)),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // Array shared within threads of the same team
+                int* s_A = ctx.getSharedMemory<int>(N);
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    s_A[c] = c + N*r;
+                });
+
+                ctx.teamSync();
+
+                //read values written by other threads of the team
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    const int idx = c + N*r;
+                    working_array[idx] = s_A[N - 1 - c];
+                });
+
+                ctx.teamSync();
+                ctx.releaseSharedMemory();
+
+              });  // loop r
+        });  // outer lambda
+
+
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(N - 1 - c + N*r, check_array[c + r*N]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsSharedMemTest);
+template <typename T>
+class TeamsSharedMemTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsSharedMemTest, SharedMemTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsSharedMemTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsSharedMemTest,
+                            SharedMemTeams);
+
+#endif  // __TEST_TEAMS_SHARED_MEM_HPP__
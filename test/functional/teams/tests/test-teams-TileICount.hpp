@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_TILE_ICOUNT_HPP__
+#define __TEST_TEAMS_TILE_ICOUNT_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsTileICountTestImpl()
+{
+
+  // tile size does not divide N, so the last tile is shorter
+  const int N = 1003;
+  const int tile_size = 16;
+
+  camp::resources::Resource working_res{WORKING_RES()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(2*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(4), RAJA::expt::Threads(4)),
+        [=](RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::tile<TEAM_POLICY>(ctx, tile_size, RAJA::RangeSegment(0, N),
+            [&](RAJA::RangeSegment const &r_tile) {
+
+                RAJA::expt::loop_icount<THREAD_POLICY>(ctx, r_tile, [&](int r, int i) {
+                    working_array[r] = r;
+                    working_array[N + r] = i;
+                });
+
+              });  // tile r
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * 2*N);
+
+  for (int r = 0; r < N; ++r) {
+    ASSERT_EQ(r, check_array[r]);
+    ASSERT_EQ(r % tile_size, check_array[N + r]);
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsTileICountTest);
+template <typename T>
+class TeamsTileICountTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsTileICountTest, TileICountTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsTileICountTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsTileICountTest,
+                            TileICountTeams);
+
+#endif  // __TEST_TEAMS_TILE_ICOUNT_HPP__
@@ -17,6 +17,7 @@ using SequentialAtomicPols =
               RAJA::auto_atomic,
               RAJA::builtin_atomic,
 #endif
+              RAJA::std_atomic,
               RAJA::seq_atomic
             >;
 
@@ -27,6 +28,7 @@ using OpenMPAtomicPols =
               RAJA::omp_atomic,
               RAJA::builtin_atomic,
 #endif
+              RAJA::std_atomic,
               RAJA::auto_atomic
             >;
 #endif  // RAJA_ENABLE_OPENMP
@@ -24,6 +24,7 @@ using SequentialResourceList = HostResourceList;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPResourceList = HostResourceList;
+using OpenMPTeamResourceList = HostResourceList;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
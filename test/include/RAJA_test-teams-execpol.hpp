@@ -40,7 +40,11 @@ using Sequential_launch_policies = camp::list<
         camp::list<
          RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
          RAJA::expt::LoopPolicy<RAJA::loop_exec>,
-         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::simd_exec>>>;
 #endif // Sequential + device policies
 
 
@@ -54,10 +58,23 @@ using omp_cuda_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::cuda_thread_x_loop>
   >;
 
+using omp_team_cuda_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::cuda_thread_x_loop>
+  >;
+
 using OpenMP_launch_policies = camp::list<
-         omp_cuda_policies
+         omp_cuda_policies,
+         omp_team_cuda_policies
          >;
 
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::cuda_thread_x_loop>>>;
+
 #elif defined(RAJA_ENABLE_HIP)
 
 using omp_hip_policies = camp::list<
@@ -66,15 +83,38 @@ using omp_hip_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::hip_thread_x_loop>
   >;
 
+using omp_team_hip_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::hip_thread_x_loop>
+  >;
+
 using OpenMP_launch_policies = camp::list<
-         omp_hip_policies
+         omp_hip_policies,
+         omp_team_hip_policies
          >;
+
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::hip_thread_x_loop>>>;
 #else
 using OpenMP_launch_policies = camp::list<
         camp::list<
          RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
          RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec>,
-         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop>>>;
+
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop>>>;
 #endif
 
 #endif  // RAJA_ENABLE_OPENMP
@@ -106,4 +106,77 @@ TEST (KernelDynamicTile, Tile3D) {
 
   delete[] expected;
   delete[] actual;
-}
\ No newline at end of file
+}
+
+TEST(KernelCacheTile, TileHierarchy2D) {
+
+  const int DIM_X = 101;
+  const int DIM_Y = 67;
+
+  double* expected = new double[DIM_X * DIM_Y];
+  RAJA::View<double, RAJA::Layout<2> > expectedView(expected, DIM_Y, DIM_X);
+  double* actual = new double[DIM_X * DIM_Y];
+  RAJA::View<double, RAJA::Layout<2> > actualView(actual, DIM_Y, DIM_X);
+
+  using OuterTarget = RAJA::cache_target<2, 1>;
+  using InnerTarget = RAJA::cache_target<1, 1>;
+
+  using ExecPolicy = RAJA::KernelPolicy<
+      RAJA::statement::TileHierarchy<RAJA::ArgList<1, 0>,
+                                     camp::list<OuterTarget, InnerTarget>,
+                                     double, 1, RAJA::seq_exec,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::Lambda<0>>>>>;
+
+  int i = 0;
+  RAJA::kernel<ExecPolicy>(
+    RAJA::make_tuple(RAJA::RangeSegment{0,DIM_X}, RAJA::RangeSegment{0,DIM_Y}),
+    [actualView, &i] (int x, int y) {
+      actualView(y, x) = ++i;
+    });
+
+  const int OUTER = RAJA::tile_cache<OuterTarget, 2, double>::get_size();
+  const int INNER = RAJA::tile_cache<InnerTarget, 2, double>::get_size();
+  ASSERT_GE(OUTER, 1);
+  ASSERT_GE(INNER, 1);
+
+  i = 0;
+  for (int outer_y = 0; outer_y < DIM_Y; outer_y += OUTER) {
+    for (int outer_x = 0; outer_x < DIM_X; outer_x += OUTER) {
+      const int end_y = std::min({outer_y + OUTER, DIM_Y});
+      const int end_x = std::min({outer_x + OUTER, DIM_X});
+      for (int tile_y = outer_y; tile_y < end_y; tile_y += INNER) {
+        for (int tile_x = outer_x; tile_x < end_x; tile_x += INNER) {
+          for (int y = tile_y; y < std::min({tile_y + INNER, end_y}); ++y) {
+            for (int x = tile_x; x < std::min({tile_x + INNER, end_x}); ++x) {
+              expectedView(y, x) = ++i;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (int idx = 0; idx < DIM_X * DIM_Y; ++idx) {
+    ASSERT_EQ(actual[idx], expected[idx]) << "Vectors x and y differ at index " << idx;
+  }
+
+  delete[] expected;
+  delete[] actual;
+}
+
+TEST(KernelCacheTile, TileSize) {
+
+  // 64 doubles fill a 4x4x4 tile, edges below a cache line are not rounded
+  ASSERT_EQ(RAJA::detail::cache_tile_size(64 * 8.0, 3, 8, 8), 4);
+  ASSERT_EQ(RAJA::detail::cache_tile_size(1000.0, 2, 8, 8), 8);
+  ASSERT_EQ(RAJA::detail::cache_tile_size(512.0 * 512 * 8, 2, 8, 8), 512);
+  ASSERT_EQ(RAJA::detail::cache_tile_size(8.0, 2, 16, 4), 1);
+
+  const RAJA::CacheInfo& info = RAJA::get_cache_info();
+  ASSERT_GT(info.line_size, 0u);
+  ASSERT_GT(info.level_size(1), 0u);
+  ASSERT_GE(info.level_size(2), info.level_size(1));
+  ASSERT_GE(info.level_size(3), info.level_size(2));
+}
@@ -1641,6 +1641,136 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+TEST(Kernel, Collapse9)
+{
+
+  int N = 3;
+  int M = 5;
+  int K = 4;
+  int P = 7;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<0, 1, 2, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          Index_type id = r + P * (i + N * (j + M * k));
+          ASSERT_EQ(data[id], id);
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse10)
+{
+
+  int N = 3;
+  int M = 2;
+  int K = 4;
+  int P = 5;
+  int Q = 3;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<4, 0, 1, 2, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r, Index_type q) {
+        Index_type id = q + Q * (r + P * (i + N * (j + M * k)));
+        data[id] += id;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          for (int q = 0; q < Q; ++q) {
+            Index_type id = q + Q * (r + P * (i + N * (j + M * k)));
+            ASSERT_EQ(data[id], id);
+          }
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, CollapseTile)
+{
+
+  int N = 7;
+  int M = 5;
+  int K = 9;
+  int P = 4;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_tile_exec<4, 2, 3, 4>,
+                                ArgList<0, 1, 2, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          Index_type id = r + P * (i + N * (j + M * k));
+          ASSERT_EQ(data[id], id);
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
 
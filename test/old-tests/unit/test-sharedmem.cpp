@@ -467,6 +467,30 @@ using SeqTypes =
 
           RAJA::statement::InitLocalMem<RAJA::cpu_tile_mem, RAJA::ParamList<0,1>,
 
+              //Load data into shared memory
+              RAJA::statement::For<1, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                                   >
+                                 >,
+
+                //Read data from shared memory
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::For<0, RAJA::loop_exec,
+                    RAJA::statement::Lambda<1> > >
+
+              > //close shared memory scope
+            >//for 2
+        >//for 3
+      > //kernel policy
+    > //list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+        RAJA::statement::For<3, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,
+
+          RAJA::statement::InitLocalMem<RAJA::cpu_pool_tile_mem, RAJA::ParamList<0,1>,
+
               //Load data into shared memory
               RAJA::statement::For<1, RAJA::loop_exec,
                 RAJA::statement::For<0, RAJA::loop_exec,
@@ -573,6 +597,54 @@ using TestTypes =
 
           RAJA::statement::InitLocalMem<RAJA::cpu_tile_mem,RAJA::ParamList<0,1>,
 
+           //Load data into shared memory
+           RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<0>
+              >
+             >,
+
+           //Read data from shared memory
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<1>
+           >
+          >
+         > //close shared mem window
+       >//outer collapsed
+      > //close policy list
+     > //close list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+           RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                     RAJA::ArgList<2, 3>,
+
+          RAJA::statement::InitLocalMem<RAJA::cpu_pool_tile_mem,RAJA::ParamList<0,1>,
+
+           //Load data into shared memory
+           RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<0>
+              >
+             >,
+
+           //Read data from shared memory
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<1>
+           >
+          >
+         > //close shared mem window
+       >//outer collapsed
+      > //close policy list
+     > //close list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+           RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                     RAJA::ArgList<2, 3>,
+
+          RAJA::statement::InitLocalMem<RAJA::cpu_hugepage_tile_mem,RAJA::ParamList<0,1>,
+
            //Load data into shared memory
            RAJA::statement::For<1, RAJA::loop_exec,
               RAJA::statement::For<0, RAJA::loop_exec,
@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the sorting networks of small_sort
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+using SmallSortTypes = ::testing::Types<int, double>;
+
+template<typename T>
+class SmallSortUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(SmallSortUnitTest, SmallSortTypes);
+
+//
+// Sizes of Batcher's merge exchange networks for 0 to 16 items
+//
+static const int batcher_sizes[] = {0, 0, 1, 3, 5, 9, 12, 16, 19,
+                                    26, 31, 37, 41, 48, 53, 59, 63};
+
+//
+// Comparator that counts its calls
+//
+template <typename Compare>
+struct CountingCompare
+{
+  Compare comp;
+  int* count;
+
+  template <typename T>
+  bool operator()(T const& a, T const& b) const
+  {
+    ++*count;
+    return comp(a, b);
+  }
+};
+
+//
+// small_sort v with comp and compare against std::sort, checking the
+// number of comparisons made by the sorting networks for N <= 16
+//
+template <typename T, typename Compare, typename StdCompare>
+void checkSmallSort(std::vector<T> v, Compare comp, StdCompare std_comp)
+{
+  const int N = static_cast<int>(v.size());
+
+  std::vector<T> expected = v;
+  std::sort(expected.begin(), expected.end(), std_comp);
+
+  int count = 0;
+  RAJA::detail::small_sort(v.begin(), v.end(),
+                           CountingCompare<Compare>{comp, &count});
+
+  ASSERT_EQ(expected, v);
+  if (N <= 16) {
+    ASSERT_EQ(batcher_sizes[N], count);
+  }
+}
+
+TYPED_TEST(SmallSortUnitTest, NetworkSizes)
+{
+  for (int N = 0; N <= 16; ++N) {
+    ASSERT_EQ(batcher_sizes[N],
+              RAJA::detail::odd_even_merge_network_comparator(N, -1, false));
+  }
+}
+
+TYPED_TEST(SmallSortUnitTest, Sorts)
+{
+  std::mt19937 rng(17);
+  std::uniform_int_distribution<int> dist(-20, 20);
+
+  for (int N = 0; N <= 17; ++N) {
+
+    std::vector<TypeParam> random(N);
+    std::vector<TypeParam> descending(N);
+    std::vector<TypeParam> equal(N, TypeParam(3));
+    for (int i = 0; i < N; ++i) {
+      random[i] = static_cast<TypeParam>(dist(rng));
+      descending[i] = static_cast<TypeParam>(N - i);
+    }
+
+    for (std::vector<TypeParam> const& v : {random, descending, equal}) {
+      checkSmallSort(v, RAJA::operators::less<TypeParam>{},
+                     std::less<TypeParam>{});
+      checkSmallSort(v, RAJA::operators::greater<TypeParam>{},
+                     std::greater<TypeParam>{});
+    }
+  }
+}
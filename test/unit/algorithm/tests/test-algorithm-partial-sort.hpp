@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for partial_sort, nth_element, and top_k
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_PARTIAL_SORT_HPP__
+#define __TEST_UNIT_ALGORITHM_PARTIAL_SORT_HPP__
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template < typename ExecPolicy >
+void testPartialSort(int N, int max_val)
+{
+  std::mt19937 rng(N);
+  std::uniform_int_distribution<int> dist(0, max_val);
+
+  std::vector<int> orig(N);
+  for (int i = 0; i < N; ++i) {
+    orig[i] = dist(rng);
+  }
+  std::vector<int> sorted = orig;
+  std::sort(sorted.begin(), sorted.end());
+
+  for (int k : {0, 1, 5, N/2, N-1, N}) {
+    if (k < 0 || k > N) {
+      continue;
+    }
+
+    // nth_element places the item and splits the rest around it
+    if (k < N) {
+      std::vector<int> a = orig;
+      RAJA::nth_element<ExecPolicy>(a.data(), a.data()+k, a.data()+N);
+      ASSERT_EQ(sorted[k], a[k]);
+      for (int i = 0; i < k; ++i) {
+        ASSERT_LE(a[i], a[k]);
+      }
+      for (int i = k+1; i < N; ++i) {
+        ASSERT_GE(a[i], a[k]);
+      }
+      std::sort(a.begin(), a.end());
+      ASSERT_EQ(sorted, a);
+    }
+
+    // partial_sort sorts the k smallest into the front
+    {
+      std::vector<int> a = orig;
+      RAJA::partial_sort<ExecPolicy>(a.data(), a.data()+k, a.data()+N);
+      for (int i = 0; i < k; ++i) {
+        ASSERT_EQ(sorted[i], a[i]);
+      }
+      std::sort(a.begin(), a.end());
+      ASSERT_EQ(sorted, a);
+    }
+
+    // top_k copies the k largest out and leaves the input alone
+    {
+      std::vector<int> a = orig;
+      std::vector<int> out(k+1, -1);
+      RAJA::top_k<ExecPolicy>(a.data(), a.data()+N, k, out.data(),
+                              RAJA::operators::greater<int>{});
+      for (int i = 0; i < k; ++i) {
+        ASSERT_EQ(sorted[N-1-i], out[i]);
+      }
+      ASSERT_EQ(-1, out[k]);
+      ASSERT_EQ(orig, a);
+    }
+  }
+}
+
+TYPED_TEST_SUITE_P(PartialSortUnitTest);
+template <typename T>
+class PartialSortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(PartialSortUnitTest, UnitPartialSort)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  for (int N : {1, 7, 100, 1000, 100000}) {
+    // few distinct values, so there are many ties
+    testPartialSort<ExecPolicy>(N, 3);
+    testPartialSort<ExecPolicy>(N, N);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(PartialSortUnitTest, UnitPartialSort);
+
+using SequentialPartialSortPolicies =
+  camp::list<
+              RAJA::loop_exec,
+              RAJA::seq_exec
+            >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPPartialSortPolicies =
+  camp::list<
+              RAJA::omp_parallel_for_exec
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+using TBBPartialSortPolicies =
+  camp::list<
+              RAJA::tbb_for_exec
+            >;
+
+#endif
+
+#endif // __TEST_UNIT_ALGORITHM_PARTIAL_SORT_HPP__
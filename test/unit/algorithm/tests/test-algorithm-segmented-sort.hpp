@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for segmented_sort and segmented_sort_pairs
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
+#define __TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template < typename ExecPolicy >
+void testSegmentedSort(std::vector<int> const& sizes)
+{
+  std::mt19937 rng(sizes.size());
+  std::uniform_int_distribution<int> dist(0, 1000);
+
+  std::vector<int> offsets(1, 0);
+  for (int size : sizes) {
+    offsets.push_back(offsets.back() + size);
+  }
+  const int N = offsets.back();
+  const int num_segments = static_cast<int>(sizes.size());
+
+  std::vector<int> keys(N);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = dist(rng);
+    vals[i] = 3*keys[i] + 1;
+  }
+
+  std::vector<int> expected = keys;
+  for (int s = 0; s < num_segments; ++s) {
+    std::sort(expected.begin() + offsets[s], expected.begin() + offsets[s+1],
+              std::greater<int>{});
+  }
+
+  std::vector<int> sorted = keys;
+  RAJA::segmented_sort<ExecPolicy>(sorted.data(),
+                                   offsets.data(), offsets.data() + num_segments+1,
+                                   RAJA::operators::greater<int>{});
+  ASSERT_EQ(expected, sorted);
+
+  RAJA::segmented_sort_pairs<ExecPolicy>(keys.data(), vals.data(),
+                                         offsets.data(), offsets.data() + num_segments+1,
+                                         RAJA::operators::greater<int>{});
+  ASSERT_EQ(expected, keys);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(3*keys[i] + 1, vals[i]);
+  }
+}
+
+TYPED_TEST_SUITE_P(SegmentedSortUnitTest);
+template <typename T>
+class SegmentedSortUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SegmentedSortUnitTest, UnitSegmentedSort)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  testSegmentedSort<ExecPolicy>({});
+  testSegmentedSort<ExecPolicy>({0, 1, 0});
+
+  // many small segments of every size that is sorted in a different way
+  std::vector<int> sizes;
+  for (int i = 0; i < 10000; ++i) {
+    sizes.push_back(i % 70);
+  }
+  sizes.push_back(500);
+  sizes.push_back(100000);
+  sizes.push_back(3);
+  testSegmentedSort<ExecPolicy>(sizes);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedSortUnitTest, UnitSegmentedSort);
+
+using SequentialSegmentedSortPolicies =
+  camp::list<
+              RAJA::loop_exec,
+              RAJA::seq_exec
+            >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPSegmentedSortPolicies =
+  camp::list<
+              RAJA::omp_parallel_for_exec
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+using TBBSegmentedSortPolicies =
+  camp::list<
+              RAJA::tbb_for_exec
+            >;
+
+#endif
+
+#endif // __TEST_UNIT_ALGORITHM_SEGMENTED_SORT_HPP__
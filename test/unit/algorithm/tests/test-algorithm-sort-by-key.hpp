@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for sort_by_key and stable_sort_by_key
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_SORT_BY_KEY_HPP__
+#define __TEST_UNIT_ALGORITHM_SORT_BY_KEY_HPP__
+
+#include <random>
+#include <vector>
+
+// a value too wide to be worth moving in every swap
+struct SortByKeyWideValue
+{
+  double a, b, c, d;
+};
+
+template < typename ExecPolicy, bool stable >
+void testSortByKey(int N, int form)
+{
+  std::mt19937 rng(N);
+  // few distinct keys, so there are many ties
+  std::uniform_int_distribution<int> dist(0, N/8 + 1);
+
+  std::vector<int> keys(N);
+  std::vector<int> index(N);
+  std::vector<SortByKeyWideValue> wide(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = dist(rng);
+    index[i] = i;
+    wide[i] = SortByKeyWideValue{double(i), double(keys[i]), -double(i), 0.5};
+  }
+  const std::vector<int> orig_keys = keys;
+
+  // calls with iterators or containers, with or without a comparator
+  if (stable) {
+    switch (form) {
+      case 0:
+        RAJA::stable_sort_by_key<ExecPolicy>(keys.data(), keys.data()+N,
+                                             RAJA::operators::less<int>{},
+                                             index.data(), wide.data());
+        break;
+      case 1:
+        RAJA::stable_sort_by_key<ExecPolicy>(keys.data(), keys.data()+N,
+                                             index.data(), wide.data());
+        break;
+      case 2:
+        RAJA::stable_sort_by_key<ExecPolicy>(keys,
+                                             RAJA::operators::less<int>{},
+                                             index, wide);
+        break;
+      default:
+        RAJA::stable_sort_by_key<ExecPolicy>(keys, index, wide);
+        break;
+    }
+  } else {
+    switch (form) {
+      case 0:
+        RAJA::sort_by_key<ExecPolicy>(keys.data(), keys.data()+N,
+                                      RAJA::operators::less<int>{},
+                                      index.data(), wide.data());
+        break;
+      case 1:
+        RAJA::sort_by_key<ExecPolicy>(keys.data(), keys.data()+N,
+                                      index.data(), wide.data());
+        break;
+      case 2:
+        RAJA::sort_by_key<ExecPolicy>(keys,
+                                      RAJA::operators::less<int>{},
+                                      index, wide);
+        break;
+      default:
+        RAJA::sort_by_key<ExecPolicy>(keys, index, wide);
+        break;
+    }
+  }
+
+  std::vector<int> seen(N, 0);
+  for (int i = 0; i < N; ++i) {
+    if (i > 0) {
+      ASSERT_LE(keys[i-1], keys[i]);
+      if (stable && keys[i-1] == keys[i]) {
+        ASSERT_LT(index[i-1], index[i]);
+      }
+    }
+    const int j = index[i];
+    ASSERT_LE(0, j);
+    ASSERT_LT(j, N);
+    ASSERT_EQ(0, seen[j]++);
+    ASSERT_EQ(orig_keys[j], keys[i]);
+    ASSERT_EQ(double(j), wide[i].a);
+    ASSERT_EQ(double(keys[i]), wide[i].b);
+    ASSERT_EQ(-double(j), wide[i].c);
+  }
+}
+
+TYPED_TEST_SUITE_P(SortByKeyUnitTest);
+template <typename T>
+class SortByKeyUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(SortByKeyUnitTest, UnitSortByKey)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+
+  for (int N : {0, 1, 7, 100, 1000, 100000}) {
+    testSortByKey<ExecPolicy, false>(N, 0);
+    testSortByKey<ExecPolicy, true>(N, 0);
+  }
+
+  for (int form : {1, 2, 3}) {
+    testSortByKey<ExecPolicy, false>(1000, form);
+    testSortByKey<ExecPolicy, true>(1000, form);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortByKeyUnitTest, UnitSortByKey);
+
+using SequentialSortByKeyPolicies =
+  camp::list<
+              RAJA::loop_exec,
+              RAJA::seq_exec
+            >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+using OpenMPSortByKeyPolicies =
+  camp::list<
+              RAJA::omp_parallel_for_exec
+            >;
+
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+
+using TBBSortByKeyPolicies =
+  camp::list<
+              RAJA::tbb_for_exec
+            >;
+
+#endif
+
+#endif // __TEST_UNIT_ALGORITHM_SORT_BY_KEY_HPP__
@@ -22,6 +22,8 @@
 
 #include "test-algorithm-sort-utils.hpp"
 
+#include <memory>
+
 template < typename policy >
 struct PolicySort
   : PolicySynchronize<policy>
@@ -81,12 +83,52 @@ struct PolicySortPairs
 };
 
 
+// passes a scratch memory allocator
+template < typename policy >
+struct PolicySortScratch
+  : PolicySynchronize<policy>
+{
+  using sort_category = unstable_sort_tag;
+  using sort_interface = sort_interface_tag;
+
+  std::string m_name;
+
+  PolicySortScratch()
+    : m_name("RAJA::sort<unknown>[scratch]")
+  { }
+
+  PolicySortScratch(std::string const& policy_name)
+    : m_name(std::string("RAJA::sort<") + policy_name + std::string(">[scratch]"))
+  { }
+
+  const char* name()
+  {
+    return m_name.c_str();
+  }
+
+  template < typename Iter >
+  void operator()(Iter begin, Iter end)
+  {
+    using T = RAJA::detail::IterVal<Iter>;
+    RAJA::sort<policy>(begin, end, RAJA::operators::less<T>{},
+                       std::allocator<char>{});
+  }
+
+  template < typename Iter, typename Compare >
+  void operator()(Iter begin, Iter end, Compare comp)
+  {
+    RAJA::sort<policy>(begin, end, comp, std::allocator<char>{});
+  }
+};
+
 using SequentialSortSorters =
   camp::list<
               PolicySort<RAJA::loop_exec>,
               PolicySortPairs<RAJA::loop_exec>,
+              PolicySortScratch<RAJA::loop_exec>,
               PolicySort<RAJA::seq_exec>,
-              PolicySortPairs<RAJA::seq_exec>
+              PolicySortPairs<RAJA::seq_exec>,
+              PolicySortScratch<RAJA::seq_exec>
             >;
 
 #if defined(RAJA_ENABLE_OPENMP)
@@ -94,7 +136,8 @@ using SequentialSortSorters =
 using OpenMPSortSorters =
   camp::list<
               PolicySort<RAJA::omp_parallel_for_exec>,
-              PolicySortPairs<RAJA::omp_parallel_for_exec>
+              PolicySortPairs<RAJA::omp_parallel_for_exec>,
+              PolicySortScratch<RAJA::omp_parallel_for_exec>
             >;
 
 #endif
@@ -104,7 +147,8 @@ using OpenMPSortSorters =
 using TBBSortSorters =
   camp::list<
               PolicySort<RAJA::tbb_for_exec>,
-              PolicySortPairs<RAJA::tbb_for_exec>
+              PolicySortPairs<RAJA::tbb_for_exec>,
+              PolicySortScratch<RAJA::tbb_for_exec>
             >;
 
 #endif
@@ -22,6 +22,8 @@
 
 #include "test-algorithm-sort-utils.hpp"
 
+#include <memory>
+
 
 template < typename policy >
 struct PolicyStableSort
@@ -81,12 +83,52 @@ struct PolicyStableSortPairs
   }
 };
 
+// passes a scratch memory allocator
+template < typename policy >
+struct PolicyStableSortScratch
+  : PolicySynchronize<policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+
+  std::string m_name;
+
+  PolicyStableSortScratch()
+    : m_name("RAJA::stable_sort<unknown>[scratch]")
+  { }
+
+  PolicyStableSortScratch(std::string const& policy_name)
+    : m_name(std::string("RAJA::stable_sort<") + policy_name + std::string(">[scratch]"))
+  { }
+
+  const char* name()
+  {
+    return m_name.c_str();
+  }
+
+  template < typename Iter >
+  void operator()(Iter begin, Iter end)
+  {
+    using T = RAJA::detail::IterVal<Iter>;
+    RAJA::stable_sort<policy>(begin, end, RAJA::operators::less<T>{},
+                       std::allocator<char>{});
+  }
+
+  template < typename Iter, typename Compare >
+  void operator()(Iter begin, Iter end, Compare comp)
+  {
+    RAJA::stable_sort<policy>(begin, end, comp, std::allocator<char>{});
+  }
+};
+
 using SequentialStableSortSorters =
   camp::list<
               PolicyStableSort<RAJA::loop_exec>,
               PolicyStableSortPairs<RAJA::loop_exec>,
+              PolicyStableSortScratch<RAJA::loop_exec>,
               PolicyStableSort<RAJA::seq_exec>,
-              PolicyStableSortPairs<RAJA::seq_exec>
+              PolicyStableSortPairs<RAJA::seq_exec>,
+              PolicyStableSortScratch<RAJA::seq_exec>
             >;
 
 #if defined(RAJA_ENABLE_OPENMP)
@@ -94,7 +136,8 @@ using SequentialStableSortSorters =
 using OpenMPStableSortSorters =
   camp::list<
               PolicyStableSort<RAJA::omp_parallel_for_exec>,
-              PolicyStableSortPairs<RAJA::omp_parallel_for_exec>
+              PolicyStableSortPairs<RAJA::omp_parallel_for_exec>,
+              PolicyStableSortScratch<RAJA::omp_parallel_for_exec>
             >;
 
 #endif
@@ -104,7 +147,8 @@ using OpenMPStableSortSorters =
 using TBBStableSortSorters =
   camp::list<
               PolicyStableSort<RAJA::tbb_for_exec>,
-              PolicyStableSortPairs<RAJA::tbb_for_exec>
+              PolicyStableSortPairs<RAJA::tbb_for_exec>,
+              PolicyStableSortScratch<RAJA::tbb_for_exec>
             >;
 
 #endif
@@ -74,14 +74,19 @@ REGISTER_TYPED_TEST_SUITE_P( AtomicRefBasicExchangeUnitTest,
 using basic_types = 
     ::testing::Types<
                       std::tuple<int, RAJA::builtin_atomic>,
+                      std::tuple<int, RAJA::std_atomic>,
                       std::tuple<int, RAJA::seq_atomic>,
                       std::tuple<unsigned int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned int, RAJA::std_atomic>,
                       std::tuple<unsigned int, RAJA::seq_atomic>,
                       std::tuple<unsigned long long int, RAJA::builtin_atomic>,
+                      std::tuple<unsigned long long int, RAJA::std_atomic>,
                       std::tuple<unsigned long long int, RAJA::seq_atomic>,
                       std::tuple<float, RAJA::builtin_atomic>,
+                      std::tuple<float, RAJA::std_atomic>,
                       std::tuple<float, RAJA::seq_atomic>,
                       std::tuple<double, RAJA::builtin_atomic>,
+                      std::tuple<double, RAJA::std_atomic>,
                       std::tuple<double, RAJA::seq_atomic>
 #if defined(RAJA_ENABLE_OPENMP)
                       ,
@@ -0,0 +1,214 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for CompressedListSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <vector>
+
+//
+// Index types wide enough to hold indices spanning several blocks
+//
+using CompressedListIndexTypes = ::testing::Types<RAJA::Index_type,
+                                                  int,
+                                                  unsigned int,
+                                                  long long,
+                                                  unsigned long long>;
+
+template<typename T>
+class CompressedListSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(CompressedListSegmentUnitTest, CompressedListIndexTypes);
+
+//
+// Short ascending runs separated by small gaps, spanning several blocks
+//
+template <typename T>
+std::vector<T> makeRunIndices(size_t len)
+{
+  std::vector<T> idx;
+  T val = 0;
+  size_t run = 0;
+  while (idx.size() < len) {
+    idx.push_back(val);
+    ++val;
+    if (++run % 7 == 0) {
+      val += static_cast<T>(run % 5 + 1);
+    }
+  }
+  return idx;
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Constructors)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(1000);
+
+  RAJA::TypedCompressedListSegment<TypeParam> list1(&idx[0], idx.size());
+  RAJA::TypedCompressedListSegment<TypeParam> copied(list1);
+
+  ASSERT_EQ(list1, copied);
+
+  RAJA::TypedCompressedListSegment<TypeParam> moved(std::move(list1));
+
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedCompressedListSegment<TypeParam> container(idx);
+
+  ASSERT_EQ(copied, container);
+  ASSERT_TRUE(container.indicesEqual(&idx[0], idx.size()));
+
+  RAJA::TypedCompressedListSegment<TypeParam> empty(nullptr, 0);
+
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Swaps)
+{
+  std::vector<TypeParam> idx1;
+  std::vector<TypeParam> idx2;
+  for (TypeParam i = 0; i < 5; ++i){
+    idx1.push_back(i);
+    idx2.push_back(i+5);
+  }
+
+  RAJA::TypedCompressedListSegment<TypeParam> list1( idx1 );
+  RAJA::TypedCompressedListSegment<TypeParam> list2( idx2 );
+  auto list3 = RAJA::TypedCompressedListSegment<TypeParam>(list1);
+  auto list4 = RAJA::TypedCompressedListSegment<TypeParam>(list2);
+
+  list1.swap(list2);
+
+  ASSERT_EQ(list2, list3);
+  ASSERT_EQ(list1, list4);
+
+  std::swap(list1, list2);
+
+  ASSERT_EQ(list1, list3);
+  ASSERT_EQ(list2, list4);
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Equality)
+{
+  std::vector<TypeParam> idx1{5,3,1,2};
+  RAJA::TypedCompressedListSegment<TypeParam> list( idx1 );
+
+  std::vector<TypeParam> idx2{2,1,3,5};
+
+  ASSERT_EQ(list.indicesEqual( &idx2.begin()[0], idx2.size() ), false);
+  ASSERT_NE(list, RAJA::TypedCompressedListSegment<TypeParam>( idx2 ));
+
+  std::reverse( idx2.begin(), idx2.end() );
+
+  ASSERT_EQ(list.indicesEqual( &idx2.begin()[0], idx2.size() ), true);
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Iterators)
+{
+  std::vector<TypeParam> idx1{5,3,1,2};
+  RAJA::TypedCompressedListSegment<TypeParam> list( idx1 );
+
+  ASSERT_EQ(TypeParam(5), *list.begin());
+  ASSERT_EQ(TypeParam(2), *(list.end()-1));
+  ASSERT_EQ(TypeParam(1), list.begin()[2]);
+
+  ASSERT_EQ(4, list.size());
+  ASSERT_EQ(4, list.end() - list.begin());
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Decode)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(1000);
+  RAJA::TypedCompressedListSegment<TypeParam> list( idx );
+
+  auto it = list.begin();
+  for (size_t i = 0; i < idx.size(); ++i) {
+    ASSERT_EQ(idx[i], it[i]);
+  }
+
+  std::vector<TypeParam> out(idx.size() - 100);
+  list.decode(100, out.size(), &out[0]);
+  for (size_t i = 0; i < out.size(); ++i) {
+    ASSERT_EQ(idx[i + 100], out[i]);
+  }
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, DecodeContiguous)
+{
+  // runs of consecutive indices pack into width 0 blocks with no words, up
+  // to a partial last block
+  for (size_t len : {size_t(1), size_t(128), size_t(1000)}) {
+    std::vector<TypeParam> idx;
+    for (size_t i = 0; i < len; ++i) {
+      idx.push_back(static_cast<TypeParam>(i + 5));
+    }
+    RAJA::TypedCompressedListSegment<TypeParam> list( idx );
+
+    auto it = list.begin();
+    for (size_t i = 0; i < idx.size(); ++i) {
+      ASSERT_EQ(idx[i], it[i]);
+    }
+
+    std::vector<TypeParam> out(idx.size());
+    list.decode(0, out.size(), &out[0]);
+    ASSERT_EQ(idx, out);
+  }
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, Compression)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(1000);
+  RAJA::TypedCompressedListSegment<TypeParam> list( idx );
+
+  ASSERT_LT(4 * list.getStorageBytes(), idx.size() * sizeof(TypeParam));
+
+  std::vector<TypeParam> contiguous;
+  for (TypeParam i = 0; i < 1000; ++i) {
+    contiguous.push_back(i + 3);
+  }
+  RAJA::TypedCompressedListSegment<TypeParam> range( contiguous );
+
+  ASSERT_LT(16 * range.getStorageBytes(),
+            contiguous.size() * sizeof(TypeParam));
+}
+
+TYPED_TEST(CompressedListSegmentUnitTest, ForallIndexSet)
+{
+  std::vector<TypeParam> idx = makeRunIndices<TypeParam>(1000);
+  RAJA::TypedCompressedListSegment<TypeParam> list( idx );
+
+  const TypeParam N = idx[idx.size() - 1] + 1;
+  std::vector<int> count(N, 0);
+  int* count_ptr = &count[0];
+
+  RAJA::forall<RAJA::simd_exec>(list, [=](TypeParam i) {
+    count_ptr[i] += 1;
+  });
+
+  using IndexSetType =
+    RAJA::TypedIndexSet<RAJA::TypedRangeSegment<TypeParam>,
+                        RAJA::TypedCompressedListSegment<TypeParam>>;
+  IndexSetType iset;
+  iset.push_back(list);
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [=](TypeParam i) {
+    count_ptr[i] += 1;
+  });
+
+  std::vector<int> expected(N, 0);
+  for (size_t i = 0; i < idx.size(); ++i) {
+    expected[idx[i]] = 2;
+  }
+  for (TypeParam i = 0; i < N; ++i) {
+    ASSERT_EQ(expected[i], count[i]);
+  }
+}
@@ -100,3 +100,38 @@ TYPED_TEST(ListSegmentUnitTest, Iterators)
   ASSERT_EQ(4, list.size());
 }
 
+
+TYPED_TEST(ListSegmentUnitTest, Span)
+{
+  std::vector<TypeParam> idx{5,3,1,2};
+
+  RAJA::TypedListSegment<TypeParam> unowned(
+      RAJA::make_span(&idx[0], idx.size()), RAJA::Unowned);
+
+  ASSERT_EQ(RAJA::Unowned, unowned.getIndexOwnership());
+  ASSERT_EQ(&idx[0], unowned.begin());
+  ASSERT_EQ(4, unowned.size());
+
+  RAJA::TypedListSegment<TypeParam> copied(unowned);
+
+  ASSERT_EQ(&idx[0], copied.begin());
+  ASSERT_EQ(unowned, copied);
+
+  RAJA::TypedListSegment<TypeParam> owned(
+      RAJA::make_span(&idx[0], idx.size()), RAJA::Owned);
+
+  ASSERT_EQ(RAJA::Owned, owned.getIndexOwnership());
+  ASSERT_NE(&idx[0], owned.begin());
+  ASSERT_EQ(unowned, owned);
+
+  const TypeParam* const_data = &idx[0];
+  RAJA::TypedListSegment<TypeParam> from_const(
+      RAJA::make_span(const_data, idx.size()), RAJA::Unowned);
+
+  ASSERT_EQ(unowned, from_const);
+
+  RAJA::TypedListSegment<TypeParam> empty(
+      RAJA::make_span(const_data, 0), RAJA::Unowned);
+
+  ASSERT_EQ(0, empty.size());
+}
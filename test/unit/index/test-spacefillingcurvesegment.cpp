@@ -0,0 +1,296 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for MortonSegment and HilbertSegment
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+//
+// Index types wide enough for the boxes below
+//
+using CurveIndexTypes = ::testing::Types<RAJA::Index_type,
+                                         int,
+                                         unsigned int,
+                                         long long>;
+
+template<typename T>
+class SpaceFillingCurveSegmentUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(SpaceFillingCurveSegmentUnitTest, CurveIndexTypes);
+
+template <typename Tuple>
+std::array<long long, 3> toArray(Tuple const& t)
+{
+  return {{static_cast<long long>(RAJA::get<0>(t)),
+           static_cast<long long>(RAJA::get<1>(t)),
+           static_cast<long long>(RAJA::get<2>(t))}};
+}
+
+//
+// Check that seg visits every point of the box [b, e) once, in increasing
+// curve order, and that random access agrees with the iteration order
+//
+template <typename Seg>
+void checkVisitsBox(Seg const& seg,
+                    std::array<long long, 3> b,
+                    std::array<long long, 3> e)
+{
+  long long n = 1;
+  for (int d = 0; d < 3; ++d) {
+    n *= e[d] - b[d];
+  }
+  ASSERT_EQ(n, static_cast<long long>(seg.size()));
+  ASSERT_EQ(n, static_cast<long long>(seg.end() - seg.begin()));
+
+  std::set<std::array<long long, 3>> seen;
+  uint64_t prev_code = 0;
+  long long rank = 0;
+  for (auto it = seg.begin(); it != seg.end(); ++it, ++rank) {
+    auto p = toArray(*it);
+    for (int d = 0; d < 3; ++d) {
+      ASSERT_LE(b[d], p[d]);
+      ASSERT_LT(p[d], e[d]);
+    }
+    ASSERT_TRUE(seen.insert(p).second);
+
+    uint64_t x[3] = {uint64_t(p[0] - b[0]),
+                     uint64_t(p[1] - b[1]),
+                     uint64_t(p[2] - b[2])};
+    uint64_t code = seg.getCurve().encode(x);
+    if (rank > 0) {
+      ASSERT_LT(prev_code, code);
+    }
+    prev_code = code;
+
+    ASSERT_EQ(p, toArray(seg.begin()[rank]));
+    ASSERT_EQ(p, toArray(*(seg.end() - (n - rank))));
+  }
+
+  auto it = seg.end();
+  for (long long r = n - 1; r >= 0; --r) {
+    --it;
+    ASSERT_EQ(toArray(seg.begin()[r]), toArray(*it));
+  }
+}
+
+TEST(SpaceFillingCurveUnitTest, MortonCurve)
+{
+  // cube, the last dimension in the lowest bit
+  int cube[3] = {8, 8, 8};
+  RAJA::MortonCurve<3> m(cube);
+  uint64_t x[3] = {1, 2, 3};
+  ASSERT_EQ(29u, m.encode(x));
+
+  // box that is not a cube is not padded to a cube
+  int box[3] = {64, 4, 17};
+  RAJA::MortonCurve<3> a(box);
+  ASSERT_EQ(6, a.bits(0));
+  ASSERT_EQ(2, a.bits(1));
+  ASSERT_EQ(5, a.bits(2));
+  for (uint64_t code = 0; code < (uint64_t(1) << 13); ++code) {
+    uint64_t y[3];
+    a.decode(code, y);
+    ASSERT_LT(y[0], 64u);
+    ASSERT_LT(y[1], 4u);
+    ASSERT_LT(y[2], 32u);
+    ASSERT_EQ(code, a.encode(y));
+  }
+
+  int big[3] = {1 << 21, 1 << 21, 1 << 21};
+  RAJA::MortonCurve<3> g(big);
+  for (int t = 0; t < 1000; ++t) {
+    uint64_t p[3] = {uint64_t(std::rand()) % (1 << 21),
+                     uint64_t(std::rand()) % (1 << 21),
+                     uint64_t(std::rand()) % (1 << 21)};
+    uint64_t q[3];
+    g.decode(g.encode(p), q);
+    ASSERT_EQ(p[0], q[0]);
+    ASSERT_EQ(p[1], q[1]);
+    ASSERT_EQ(p[2], q[2]);
+  }
+}
+
+TEST(SpaceFillingCurveUnitTest, HilbertCurve)
+{
+  int square[2] = {2, 2};
+  RAJA::HilbertCurve<2> h2(square);
+  uint64_t first[4][2] = {{0, 0}, {0, 1}, {1, 1}, {1, 0}};
+  for (uint64_t code = 0; code < 4; ++code) {
+    uint64_t x[2];
+    h2.decode(code, x);
+    ASSERT_EQ(first[code][0], x[0]);
+    ASSERT_EQ(first[code][1], x[1]);
+  }
+
+  // consecutive points of the curve are neighbors
+  int cube[3] = {13, 7, 16};
+  RAJA::HilbertCurve<3> h(cube);
+  ASSERT_EQ(4, h.bits(0));
+  uint64_t prev[3] = {0, 0, 0};
+  for (uint64_t code = 0; code < (uint64_t(1) << 12); ++code) {
+    uint64_t x[3];
+    h.decode(code, x);
+    ASSERT_EQ(code, h.encode(x));
+    if (code > 0) {
+      long long dist = 0;
+      for (int d = 0; d < 3; ++d) {
+        dist += std::llabs((long long)x[d] - (long long)prev[d]);
+      }
+      ASSERT_EQ(1, dist);
+    }
+    for (int d = 0; d < 3; ++d) {
+      prev[d] = x[d];
+    }
+  }
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, Constructors)
+{
+  RAJA::TypedMortonSegment<TypeParam, 3> first(4, 5, 6);
+  RAJA::TypedMortonSegment<TypeParam, 3> copied(first);
+
+  ASSERT_EQ(first, copied);
+  ASSERT_EQ(120, first.size());
+
+  RAJA::TypedMortonSegment<TypeParam, 3> moved(std::move(first));
+  ASSERT_EQ(moved, copied);
+
+  RAJA::TypedMortonSegment<TypeParam, 3> boxed({{0, 0, 0}}, {{4, 5, 6}});
+  ASSERT_EQ(boxed, copied);
+
+  RAJA::TypedMortonSegment<TypeParam, 3> other(4, 6, 5);
+  ASSERT_NE(other, copied);
+
+  // empty and clamped boxes
+  RAJA::TypedMortonSegment<TypeParam, 3> empty(4, 0, 5);
+  ASSERT_EQ(0, empty.size());
+  ASSERT_EQ(empty.begin(), empty.end());
+
+  RAJA::TypedHilbertSegment<TypeParam, 3> clamped({{5, 0, 0}}, {{2, 4, 4}});
+  ASSERT_EQ(0, clamped.size());
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, Swaps)
+{
+  RAJA::TypedMortonSegment<TypeParam, 2> r1(4, 4);
+  RAJA::TypedMortonSegment<TypeParam, 2> r2(3, 7);
+  RAJA::TypedMortonSegment<TypeParam, 2> r3 = r1;
+  RAJA::TypedMortonSegment<TypeParam, 2> r4 = r2;
+
+  std::swap(r1, r2);
+  ASSERT_EQ(r1, r4);
+  ASSERT_EQ(r2, r3);
+  ASSERT_EQ(21, r1.size());
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, MortonVisitsBox)
+{
+  checkVisitsBox(RAJA::TypedMortonSegment<TypeParam, 3>(16, 16, 16),
+                 {{0, 0, 0}},
+                 {{16, 16, 16}});
+  checkVisitsBox(RAJA::TypedMortonSegment<TypeParam, 3>(33, 1, 65),
+                 {{0, 0, 0}},
+                 {{33, 1, 65}});
+  checkVisitsBox(
+      RAJA::TypedMortonSegment<TypeParam, 3>({{3, 2, 5}}, {{20, 11, 6}}),
+      {{3, 2, 5}},
+      {{20, 11, 6}});
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, HilbertVisitsBox)
+{
+  checkVisitsBox(RAJA::TypedHilbertSegment<TypeParam, 3>(13, 7, 1),
+                 {{0, 0, 0}},
+                 {{13, 7, 1}});
+  checkVisitsBox(
+      RAJA::TypedHilbertSegment<TypeParam, 3>({{3, 2, 5}}, {{20, 11, 9}}),
+      {{3, 2, 5}},
+      {{20, 11, 9}});
+
+  // a cube with a power of two edge is one unbroken curve
+  RAJA::TypedHilbertSegment<TypeParam, 3> seg(8, 8, 8);
+  auto prev = toArray(*seg.begin());
+  for (auto it = seg.begin() + 1; it != seg.end(); ++it) {
+    auto p = toArray(*it);
+    long long dist = 0;
+    for (int d = 0; d < 3; ++d) {
+      dist += std::llabs(p[d] - prev[d]);
+    }
+    ASSERT_EQ(1, dist);
+    prev = p;
+  }
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, Slices)
+{
+  RAJA::TypedMortonSegment<TypeParam, 3> seg(9, 10, 11);
+  const long long n = seg.size();
+
+  for (long long start = 0; start < n; start += 37) {
+    auto slice = seg.slice(start, 50);
+    long long k = 0;
+    for (auto v : slice) {
+      ASSERT_EQ(toArray(seg.begin()[start + k]), toArray(v));
+      ++k;
+    }
+    ASSERT_EQ(std::min(50LL, n - start), k);
+  }
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, Forall)
+{
+  using seg_type = RAJA::TypedMortonSegment<TypeParam, 3>;
+  seg_type seg(7, 9, 5);
+
+  std::vector<int> count(7 * 9 * 5, 0);
+  int* c = count.data();
+  RAJA::forall<RAJA::seq_exec>(seg, [=](typename seg_type::value_type ijk) {
+    c[(RAJA::get<0>(ijk) * 9 + RAJA::get<1>(ijk)) * 5 + RAJA::get<2>(ijk)]++;
+  });
+  RAJA::forall<RAJA::loop_exec>(seg, [=](typename seg_type::value_type ijk) {
+    c[(RAJA::get<0>(ijk) * 9 + RAJA::get<1>(ijk)) * 5 + RAJA::get<2>(ijk)]++;
+  });
+
+  for (int v : count) {
+    ASSERT_EQ(2, v);
+  }
+}
+
+TYPED_TEST(SpaceFillingCurveSegmentUnitTest, Kernel)
+{
+  using seg_type = RAJA::TypedHilbertSegment<TypeParam, 2>;
+  seg_type seg(6, 10);
+
+  std::vector<int> count(3 * 6 * 10, 0);
+  int* c = count.data();
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(seg, RAJA::TypedRangeSegment<int>(0, 3)),
+      [=](typename seg_type::value_type ij, int k) {
+        c[(k * 6 + RAJA::get<0>(ij)) * 10 + RAJA::get<1>(ij)]++;
+      });
+
+  for (int v : count) {
+    ASSERT_EQ(1, v);
+  }
+}
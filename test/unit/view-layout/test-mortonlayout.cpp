@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <set>
+#include <vector>
+
+TEST(MortonLayoutTest, 3D_accessor)
+{
+  const RAJA::MortonLayout<3> layout(8, 8, 8);
+
+  ASSERT_EQ(512, layout.size());
+
+  // the last index is in the lowest bit of each group of three
+  ASSERT_EQ(0, layout(0, 0, 0));
+  ASSERT_EQ(1, layout(0, 0, 1));
+  ASSERT_EQ(2, layout(0, 1, 0));
+  ASSERT_EQ(4, layout(1, 0, 0));
+  ASSERT_EQ(29, layout(1, 2, 3));
+
+  std::set<RAJA::Index_type> seen;
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      for (int k = 0; k < 8; ++k) {
+        RAJA::Index_type lin = layout(i, j, k);
+        ASSERT_TRUE(seen.insert(lin).second);
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+}
+
+TEST(MortonLayoutTest, PaddedBox)
+{
+  // each dimension is padded to a power of two, not to a cube
+  const RAJA::MortonLayout<3> layout(10, 32, 7);
+  ASSERT_EQ(16 * 32 * 8, layout.size());
+
+  // a MortonSegment over the same box visits the storage in order
+  RAJA::MortonSegment<3> seg(10, 32, 7);
+  RAJA::Index_type prev = -1;
+  for (auto ijk : seg) {
+    RAJA::Index_type lin =
+        layout(RAJA::get<0>(ijk), RAJA::get<1>(ijk), RAJA::get<2>(ijk));
+    ASSERT_LT(prev, lin);
+    ASSERT_LT(lin, layout.size());
+    prev = lin;
+  }
+}
+
+TEST(MortonLayoutTest, View)
+{
+  const int ni = 5, nj = 6;
+  RAJA::MortonLayout<2> layout(ni, nj);
+  std::vector<int> data(layout.size(), -1);
+
+  RAJA::View<int, RAJA::MortonLayout<2>> view(data.data(), layout);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::loop_exec,
+        RAJA::statement::For<1, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, ni), RAJA::RangeSegment(0, nj)),
+      [=](RAJA::Index_type i, RAJA::Index_type j) { view(i, j) = i * nj + j; });
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(i * nj + j, data[layout(i, j)]);
+      ASSERT_EQ(i * nj + j, view(i, j));
+    }
+  }
+}
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(TiledLayoutTest, 2D_accessor)
+{
+  const RAJA::TiledLayout<8, 8> layout(100, 100);
+
+  // sizes are rounded up to whole tiles
+  ASSERT_EQ(104 * 104, layout.size());
+
+  // tiles are row-major, and so are the elements inside a tile
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(8, layout(1, 0));
+  ASSERT_EQ(64, layout(0, 8));
+  ASSERT_EQ(13 * 64, layout(8, 0));
+  ASSERT_EQ(842, layout(9, 2));
+
+  int i, j;
+  layout.toIndices(842, i, j);
+  ASSERT_EQ(9, i);
+  ASSERT_EQ(2, j);
+}
+
+TEST(TiledLayoutTest, 3D_accessor)
+{
+  // tiles that do not divide the sizes, and are not all the same
+  const RAJA::TiledLayoutT<int, 4, 2, 8> layout(13, 5, 17);
+  ASSERT_EQ(16 * 6 * 24, layout.size());
+
+  std::vector<int> hits(layout.size(), 0);
+  for (int i = 0; i < 13; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 17; ++k) {
+        int lin = layout(i, j, k);
+        ASSERT_LE(0, lin);
+        ASSERT_LT(lin, layout.size());
+        ASSERT_EQ(0, hits[lin]++);
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(i, ii);
+        ASSERT_EQ(j, jj);
+        ASSERT_EQ(k, kk);
+      }
+    }
+  }
+}
+
+TEST(TiledLayoutTest, View)
+{
+  const int ni = 11, nj = 7;
+  RAJA::TiledLayout<4, 4> layout(ni, nj);
+  std::vector<int> data(layout.size(), -1);
+
+  RAJA::View<int, RAJA::TiledLayout<4, 4>> view(data.data(), layout);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::statement::tile_fixed<4>, RAJA::loop_exec,
+        RAJA::statement::Tile<1, RAJA::statement::tile_fixed<4>, RAJA::loop_exec,
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, ni), RAJA::RangeSegment(0, nj)),
+      [=](RAJA::Index_type i, RAJA::Index_type j) { view(i, j) = i * nj + j; });
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(i * nj + j, data[layout(i, j)]);
+      ASSERT_EQ(i * nj + j, view(i, j));
+    }
+  }
+}
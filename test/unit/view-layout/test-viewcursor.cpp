@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+TEST(ViewCursorTest, Stencil)
+{
+  const int N = 9;
+  std::vector<double> a(N * N * N), b(N * N * N, 0.0), c(N * N * N, 0.0);
+  for (int i = 0; i < N * N * N; ++i) {
+    a[i] = i % 17;
+  }
+
+  using view_type = RAJA::View<double, RAJA::Layout<3>>;
+  view_type A(a.data(), N, N, N);
+  view_type B(b.data(), N, N, N);
+  view_type C(c.data(), N, N, N);
+
+  using cursor_type = RAJA::ViewCursor<view_type, 0, 1, 2>;
+
+  // loops in a different order than the view dimensions
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+  auto segs = RAJA::make_tuple(RAJA::RangeSegment(1, N - 1),
+                               RAJA::RangeSegment(1, N - 1),
+                               RAJA::RangeSegment(1, N - 1));
+
+  RAJA::kernel_param<Pol>(
+      segs,
+      RAJA::make_tuple(RAJA::make_view_cursor<0, 1, 2>(A),
+                       RAJA::make_view_cursor<0, 1, 2>(B)),
+      [=](RAJA::Index_type,
+          RAJA::Index_type,
+          RAJA::Index_type,
+          cursor_type &ac,
+          cursor_type &bc) {
+        bc() = ac(-1, 0, 0) + ac(1, 0, 0) + ac(0, -1, 0) + ac(0, 1, 0) +
+               ac(0, 0, -1) + ac(0, 0, 1) - 6.0 * ac();
+      });
+
+  RAJA::kernel<Pol>(segs,
+                    [=](RAJA::Index_type i,
+                        RAJA::Index_type j,
+                        RAJA::Index_type k) {
+                      C(i, j, k) = A(i - 1, j, k) + A(i + 1, j, k) +
+                                   A(i, j - 1, k) + A(i, j + 1, k) +
+                                   A(i, j, k - 1) + A(i, j, k + 1) -
+                                   6.0 * A(i, j, k);
+                    });
+
+  for (int i = 0; i < N * N * N; ++i) {
+    ASSERT_EQ(c[i], b[i]);
+  }
+}
+
+TEST(ViewCursorTest, OffsetLayoutTile)
+{
+  const int ni = 10, nj = 7;
+  std::vector<int> data(ni * nj, -1);
+
+  using view_type = RAJA::View<int, RAJA::OffsetLayout<2>>;
+  view_type V(data.data(), RAJA::make_offset_layout<2>({{-3, 2}}, {{6, 8}}));
+
+  using cursor_type = RAJA::ViewCursor<view_type, 1, 0>;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::statement::tile_fixed<3>, RAJA::seq_exec,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+  // view dimension 0 follows kernel argument 1, and 1 follows 0
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(2, 9), RAJA::RangeSegment(-3, 7)),
+      RAJA::make_tuple(RAJA::make_view_cursor<1, 0>(V)),
+      [=](RAJA::Index_type j, RAJA::Index_type i, cursor_type &vc) {
+        vc() = i * 100 + j;
+      });
+
+  for (int i = -3; i <= 6; ++i) {
+    for (int j = 2; j <= 8; ++j) {
+      ASSERT_EQ(i * 100 + j, V(i, j));
+    }
+  }
+}